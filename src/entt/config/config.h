@@ -22,6 +22,18 @@
 #    define ENTT_MAYBE_ATOMIC(Type) Type
 #endif
 
+#ifdef ENTT_INSTRUMENTATION
+#    include <atomic>
+#    include <cstdint>
+#    define ENTT_INSTRUMENT(expr) (void(expr))
+#else
+#    define ENTT_INSTRUMENT(expr) (void(0))
+#endif
+
+#ifndef ENTT_TRACE_BUFFER
+#    define ENTT_TRACE_BUFFER 4096
+#endif
+
 #ifndef ENTT_ID_TYPE
 #    include <cstdint>
 #    define ENTT_ID_TYPE std::uint32_t
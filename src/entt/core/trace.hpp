@@ -0,0 +1,244 @@
+#ifndef ENTT_CORE_TRACE_HPP
+#define ENTT_CORE_TRACE_HPP
+
+#include "../config/config.h"
+
+#ifdef ENTT_TRACING
+#    include <atomic>
+#    include <chrono>
+#    include <cstddef>
+#    include <cstdint>
+#    include <memory>
+#    include <mutex>
+#    include <string>
+#    include <string_view>
+#    include <utility>
+#    include <vector>
+
+namespace entt {
+
+/*! @brief Complete event recorded by the tracing facilities. */
+struct trace_event {
+    /*! @brief Category of the event, it must outlive the tracing session. */
+    std::string_view category;
+    /*! @brief Name of the event, it must outlive the tracing session. */
+    std::string_view name;
+    /*! @brief Start time of the event, in nanoseconds. */
+    std::uint64_t start;
+    /*! @brief Duration of the event, in nanoseconds. */
+    std::uint64_t duration;
+};
+
+/**
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
+ */
+
+namespace internal {
+
+class trace_buffer {
+    static_assert(ENTT_TRACE_BUFFER && ((ENTT_TRACE_BUFFER & (ENTT_TRACE_BUFFER - 1)) == 0), "ENTT_TRACE_BUFFER must be a power of two");
+    static constexpr std::size_t capacity = ENTT_TRACE_BUFFER;
+
+public:
+    trace_buffer(const std::size_t id)
+        : thread{id} {}
+
+    void push(const trace_event &event) noexcept {
+        // single producer, the owning thread is the only one to move the head
+        const auto pos = head.load(std::memory_order_relaxed);
+        events[pos & (capacity - 1u)] = event;
+        head.store(pos + 1u, std::memory_order_release);
+    }
+
+    template<typename Func>
+    void each(Func &func) const {
+        // the slot next to the head could be in use by the producer
+        const auto last = head.load(std::memory_order_acquire);
+        const auto first = last - (last < capacity ? last : (capacity - 1u));
+
+        for(auto pos = first; pos != last; ++pos) {
+            const auto event = events[pos & (capacity - 1u)];
+
+            // discards events overwritten by the producer in the meantime
+            if(head.load(std::memory_order_acquire) - pos < capacity) {
+                func(thread, event);
+            }
+        }
+    }
+
+    void clear() noexcept {
+        head.store(0u, std::memory_order_release);
+    }
+
+private:
+    std::size_t thread;
+    std::atomic<std::size_t> head{};
+    trace_event events[capacity]{};
+};
+
+struct trace_context {
+    std::mutex mutex{};
+    std::vector<std::shared_ptr<trace_buffer>> buffers{};
+};
+
+[[nodiscard]] inline trace_context &trace_context_instance() {
+    static trace_context context{};
+    return context;
+}
+
+[[nodiscard]] inline trace_buffer &trace_buffer_for_this_thread() {
+    // buffers are shared with the context to survive the threads that created them
+    thread_local const std::shared_ptr<trace_buffer> buffer = []() {
+        auto &context = trace_context_instance();
+        std::lock_guard<std::mutex> guard{context.mutex};
+        return context.buffers.emplace_back(std::make_shared<trace_buffer>(context.buffers.size()));
+    }();
+
+    return *buffer;
+}
+
+[[nodiscard]] inline std::uint64_t trace_clock() noexcept {
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+} // namespace internal
+
+/**
+ * Internal details not to be documented.
+ * @endcond
+ */
+
+/**
+ * @brief Records a complete event for the enclosing scope.
+ *
+ * Events are pushed to a ring buffer owned by the calling thread once the
+ * scope is left. Recording an event never locks nor allocates, except for the
+ * very first event recorded by a thread.
+ */
+class trace_scope {
+public:
+    /**
+     * @brief Starts recording an event.
+     * @param category Category of the event, with static storage duration.
+     * @param name Name of the event, with static storage duration.
+     */
+    trace_scope(const std::string_view category, const std::string_view name) noexcept
+        : event{category, name, internal::trace_clock(), 0u} {}
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    trace_scope(const trace_scope &) = delete;
+
+    /*! @brief Stops recording the event and pushes it to the buffer. */
+    ~trace_scope() {
+        event.duration = internal::trace_clock() - event.start;
+        internal::trace_buffer_for_this_thread().push(event);
+    }
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This object.
+     */
+    trace_scope &operator=(const trace_scope &) = delete;
+
+private:
+    trace_event event;
+};
+
+/**
+ * @brief Visits all the events recorded so far by all threads.
+ *
+ * The signature of the function should be equivalent to the following:
+ *
+ * @code{.cpp}
+ * void(const std::size_t, const trace_event &);
+ * @endcode
+ *
+ * The first argument is a sequential identifier for the thread that recorded
+ * the event.<br/>
+ * This function doesn't stop other threads from recording events. Each buffer
+ * only retains the most recent events and those overwritten during the visit
+ * are silently dropped.
+ *
+ * @tparam Func Type of the function object to invoke.
+ * @param func A valid function object.
+ */
+template<typename Func>
+void trace_each(Func func) {
+    auto &context = internal::trace_context_instance();
+    std::lock_guard<std::mutex> guard{context.mutex};
+
+    for(auto &&buffer: context.buffers) {
+        buffer->each(func);
+    }
+}
+
+/**
+ * @brief Discards all the events recorded so far.
+ *
+ * @warning
+ * Threads shouldn't record events while buffers are cleared.
+ */
+inline void trace_clear() {
+    auto &context = internal::trace_context_instance();
+    std::lock_guard<std::mutex> guard{context.mutex};
+
+    for(auto &&buffer: context.buffers) {
+        buffer->clear();
+    }
+}
+
+/**
+ * @brief Exports all the events recorded so far in the Chrome trace format.
+ *
+ * The result is a JSON document that both `chrome://tracing` and the Perfetto
+ * UI are able to open.
+ *
+ * @return The events recorded so far, in the Chrome trace format.
+ */
+[[nodiscard]] inline std::string trace_to_json() {
+    std::string json{"{\"traceEvents\":["};
+    bool first = true;
+
+    const auto append = [&json](const std::string_view str) {
+        for(auto ch: str) {
+            if(ch == '"' || ch == '\\') {
+                json.push_back('\\');
+            }
+
+            json.push_back(ch);
+        }
+    };
+
+    // timestamps are in microseconds, the fractional part retains the nanoseconds
+    const auto append_time = [&json](const std::uint64_t value) {
+        const auto fraction = std::to_string(1000u + value % 1000u);
+        json.append(std::to_string(value / 1000u)).append(".").append(fraction, 1u, 3u);
+    };
+
+    trace_each([&](const std::size_t thread, const trace_event &event) {
+        json.append(std::exchange(first, false) ? "{\"cat\":\"" : ",{\"cat\":\"");
+        append(event.category);
+        json.append("\",\"name\":\"");
+        append(event.name);
+        json.append("\",\"ph\":\"X\",\"pid\":0,\"tid\":").append(std::to_string(thread)).append(",\"ts\":");
+        append_time(event.start);
+        json.append(",\"dur\":");
+        append_time(event.duration);
+        json.push_back('}');
+    });
+
+    json.append("]}");
+    return json;
+}
+
+} // namespace entt
+
+#    define ENTT_TRACE_CAT(lhs, rhs) lhs##rhs
+#    define ENTT_TRACE_XCAT(lhs, rhs) ENTT_TRACE_CAT(lhs, rhs)
+#    define ENTT_TRACE_SCOPE(category, name) const ::entt::trace_scope ENTT_TRACE_XCAT(entt_trace_scope_, __LINE__){category, name}
+#else
+#    define ENTT_TRACE_SCOPE(category, name) (void(0))
+#endif
+
+#endif
@@ -0,0 +1,247 @@
+#ifndef ENTT_ENTITY_ACCESS_TRACKER_HPP
+#define ENTT_ENTITY_ACCESS_TRACKER_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "../container/dense_map.hpp"
+#include "../core/fwd.hpp"
+#include "../core/type_info.hpp"
+#include "../core/utility.hpp"
+#include "fwd.hpp"
+#include "organizer.hpp"
+
+namespace entt {
+
+/**
+ * @brief Reader/writer borrow tracker for the pools of a registry.
+ *
+ * An access tracker keeps a counter for each pool that exists in a registry at
+ * the time of its creation. Systems borrow pools for reading or writing before
+ * running and return them afterwards. Any number of readers or a single writer
+ * can borrow a pool at a time. Conflicting requests fail rather than wait.<br/>
+ * When a task graph is provided, the requests of each vertex are resolved
+ * once on creation. Dependencies that aren't pools of the registry, such as
+ * context variables, get a counter of their own.<br/>
+ * Borrowing and returning pools is thread safe and doesn't touch the registry.
+ *
+ * @warning
+ * Pools that don't exist when the tracker is created aren't tracked. Therefore,
+ * the registry should be frozen while systems run. Attempting to borrow a pool
+ * that isn't tracked results in undefined behavior. An assertion will abort
+ * the execution at runtime in debug mode.
+ *
+ * @tparam Registry Basic registry type.
+ */
+template<typename Registry>
+class basic_access_tracker {
+    using alloc_traits = std::allocator_traits<typename Registry::allocator_type>;
+    using counter_type = std::atomic<std::ptrdiff_t>;
+    using index_type = dense_map<id_type, std::size_t, identity, std::equal_to<id_type>, typename alloc_traits::template rebind_alloc<std::pair<const id_type, std::size_t>>>;
+    using request_type = std::pair<std::size_t, bool>;
+    using request_container_type = std::vector<request_type, typename alloc_traits::template rebind_alloc<request_type>>;
+    using offset_container_type = std::vector<std::size_t, typename alloc_traits::template rebind_alloc<std::size_t>>;
+
+    [[nodiscard]] counter_type *counter(const id_type id) {
+        const auto it = index.find(id);
+        ENTT_ASSERT(it != index.cend(), "Untracked pool");
+        return (it == index.cend()) ? nullptr : &counters[it->second];
+    }
+
+    template<typename Vertex>
+    void resolve(const Vertex &vertex) {
+        std::vector<const type_info *> info(vertex.ro_count() + vertex.rw_count());
+        const auto ro = vertex.ro_dependency(info.data(), vertex.ro_count());
+        const auto rw = vertex.rw_dependency(info.data() + ro, vertex.rw_count());
+        const auto from = requests.size();
+
+        for(std::size_t pos{}; pos < ro + rw; ++pos) {
+            // dependencies that aren't pools (for example, context variables) are tracked separately
+            const auto elem = index.try_emplace(info[pos]->hash(), index.size()).first->second;
+            requests.emplace_back(elem, !(pos < ro));
+        }
+
+        // a resource is borrowed once per vertex, for writing if any of the requests is for writing
+        std::sort(requests.begin() + from, requests.end(), [](const auto &lhs, const auto &rhs) { return lhs.first < rhs.first || (lhs.first == rhs.first && lhs.second > rhs.second); });
+        requests.erase(std::unique(requests.begin() + from, requests.end(), [](const auto &lhs, const auto &rhs) { return lhs.first == rhs.first; }), requests.end());
+        offset.push_back(requests.size());
+    }
+
+    [[nodiscard]] bool try_read(counter_type &elem) noexcept {
+        for(auto curr = elem.load(std::memory_order_relaxed); curr >= 0;) {
+            if(elem.compare_exchange_weak(curr, curr + 1, std::memory_order_acquire, std::memory_order_relaxed)) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    [[nodiscard]] bool try_write(counter_type &elem) noexcept {
+        std::ptrdiff_t expected{};
+        return elem.compare_exchange_strong(expected, -1, std::memory_order_acquire, std::memory_order_relaxed);
+    }
+
+    void release_read(counter_type &elem) noexcept {
+        [[maybe_unused]] const auto prev = elem.fetch_sub(1, std::memory_order_release);
+        ENTT_ASSERT(prev > 0, "Pool not borrowed for reading");
+    }
+
+    void release_write(counter_type &elem) noexcept {
+        ENTT_ASSERT(elem.load(std::memory_order_relaxed) == -1, "Pool not borrowed for writing");
+        elem.store(0, std::memory_order_release);
+    }
+
+public:
+    /*! Basic registry type. */
+    using registry_type = Registry;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = typename registry_type::entity_type;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Vertex type of the task graphs of an organizer. */
+    using vertex_type = typename basic_organizer<registry_type>::vertex;
+
+    /**
+     * @brief Constructs a tracker for the pools of a given registry.
+     * @param reg A valid reference to a registry.
+     */
+    explicit basic_access_tracker(const registry_type &reg)
+        : basic_access_tracker{reg, std::vector<vertex_type>{}} {}
+
+    /**
+     * @brief Constructs a tracker for the pools of a given registry and the
+     * vertices of a task graph.
+     * @param reg A valid reference to a registry.
+     * @param graph The task graph whose vertices borrow resources.
+     */
+    basic_access_tracker(const registry_type &reg, const std::vector<vertex_type> &graph)
+        : index{reg.get_allocator()},
+          requests{reg.get_allocator()},
+          offset{1u, 0u, reg.get_allocator()},
+          counters{} {
+        index.emplace(type_hash<entity_type>::value(), 0u);
+
+        for(auto &&elem: reg.storage()) {
+            index.emplace(elem.first, index.size());
+        }
+
+        offset.reserve(graph.size() + 1u);
+
+        for(auto &&vertex: graph) {
+            resolve(vertex);
+        }
+
+        counters = std::make_unique<counter_type[]>(index.size());
+    }
+
+    /**
+     * @brief Returns the number of tracked resources.
+     * @return Number of tracked resources.
+     */
+    [[nodiscard]] size_type size() const noexcept {
+        return index.size();
+    }
+
+    /**
+     * @brief Checks if a resource is tracked.
+     * @param id Name used to map the pool within the registry or hash of the
+     * type of any other resource.
+     * @return True if the resource is tracked, false otherwise.
+     */
+    [[nodiscard]] bool contains(const id_type id) const {
+        return index.contains(id);
+    }
+
+    /**
+     * @brief Borrows a pool for reading, if it isn't borrowed for writing.
+     * @param id Name used to map the pool within the registry.
+     * @return True in case of success, false otherwise.
+     */
+    [[nodiscard]] bool try_read(const id_type id) {
+        auto *elem = counter(id);
+        return !elem || try_read(*elem);
+    }
+
+    /**
+     * @brief Borrows a pool for writing, if it isn't borrowed at all.
+     * @param id Name used to map the pool within the registry.
+     * @return True in case of success, false otherwise.
+     */
+    [[nodiscard]] bool try_write(const id_type id) {
+        auto *elem = counter(id);
+        return !elem || try_write(*elem);
+    }
+
+    /**
+     * @brief Returns a pool borrowed for reading.
+     * @param id Name used to map the pool within the registry.
+     */
+    void release_read(const id_type id) {
+        if(auto *elem = counter(id); elem) {
+            release_read(*elem);
+        }
+    }
+
+    /**
+     * @brief Returns a pool borrowed for writing.
+     * @param id Name used to map the pool within the registry.
+     */
+    void release_write(const id_type id) {
+        if(auto *elem = counter(id); elem) {
+            release_write(*elem);
+        }
+    }
+
+    /**
+     * @brief Borrows all the resources a vertex of a task graph depends on.
+     *
+     * Either all the resources are borrowed or none of them is.
+     *
+     * @param pos The position of the vertex within the task graph.
+     * @return True in case of success, false otherwise.
+     */
+    [[nodiscard]] bool try_acquire(const size_type pos) {
+        ENTT_ASSERT(pos + 1u < offset.size(), "Invalid vertex");
+        const auto last = requests.cbegin() + static_cast<typename request_container_type::difference_type>(offset[pos + 1u]);
+
+        for(auto first = requests.cbegin() + static_cast<typename request_container_type::difference_type>(offset[pos]); first != last; ++first) {
+            if(!(first->second ? try_write(counters[first->first]) : try_read(counters[first->first]))) {
+                for(auto it = requests.cbegin() + static_cast<typename request_container_type::difference_type>(offset[pos]); it != first; ++it) {
+                    it->second ? release_write(counters[it->first]) : release_read(counters[it->first]);
+                }
+
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Returns all the resources a vertex of a task graph depends on.
+     * @param pos The position of the vertex within the task graph.
+     */
+    void release(const size_type pos) {
+        ENTT_ASSERT(pos + 1u < offset.size(), "Invalid vertex");
+
+        for(auto first = offset[pos], last = offset[pos + 1u]; first != last; ++first) {
+            requests[first].second ? release_write(counters[requests[first].first]) : release_read(counters[requests[first].first]);
+        }
+    }
+
+private:
+    index_type index;
+    request_container_type requests;
+    offset_container_type offset;
+    std::unique_ptr<counter_type[]> counters;
+};
+
+} // namespace entt
+
+#endif
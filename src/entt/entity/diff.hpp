@@ -0,0 +1,234 @@
+#ifndef ENTT_ENTITY_DIFF_HPP
+#define ENTT_ENTITY_DIFF_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <type_traits>
+#include "../config/config.h"
+#include "../core/type_info.hpp"
+#include "component.hpp"
+#include "entity.hpp"
+#include "fwd.hpp"
+
+namespace entt {
+
+/*! @brief Kinds of differences between registries. */
+enum class difference : std::uint8_t {
+    /*! @brief The element only belongs to the left-hand side registry. */
+    lhs_only,
+    /*! @brief The element only belongs to the right-hand side registry. */
+    rhs_only,
+    /*! @brief The element belongs to both registries with different values. */
+    value
+};
+
+/**
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
+ */
+
+namespace internal {
+
+template<typename Entity, typename Match, typename Func>
+void diff_each(const Entity *lhs, const std::size_t lhs_len, const Entity *rhs, const std::size_t rhs_len, const std::size_t chunk, Match match, Func func) {
+    for(std::size_t from{}; from < lhs_len; from += chunk) {
+        const auto to = (from + chunk) < lhs_len ? (from + chunk) : lhs_len;
+
+        // same identifiers in the same positions, the whole chunk is skipped if elements match
+        if(!(rhs_len < to) && (std::memcmp(lhs + from, rhs + from, (to - from) * sizeof(Entity)) == 0) && match(from, to)) {
+            continue;
+        }
+
+        for(auto pos = from; pos < to; ++pos) {
+            if(const auto entt = lhs[pos]; entt != tombstone) {
+                func(entt);
+            }
+        }
+    }
+}
+
+} // namespace internal
+
+/**
+ * Internal details not to be documented.
+ * @endcond
+ */
+
+/**
+ * @brief Utility class to compare two registries.
+ *
+ * Identifiers, pools and elements are compared chunk by chunk. Chunks that
+ * contain the same identifiers in the same positions on both sides are skipped
+ * as a whole if their elements are also bitwise identical, otherwise elements
+ * are compared one at a time.<br/>
+ * Bitwise comparison only applies to types with unique object representations.
+ *
+ * @tparam Registry Basic registry type.
+ */
+template<typename Registry>
+class basic_registry_diff {
+    template<typename Set, typename Match, typename Func>
+    static void each(const Set *lhs, const Set *rhs, const std::size_t chunk, Match match, Func func) {
+        const auto lhs_len = lhs ? lhs->size() : 0u;
+        const auto rhs_len = rhs ? rhs->size() : 0u;
+
+        if(lhs_len) {
+            // elements that belong to both sides are reported as candidates for value comparison
+            internal::diff_each(lhs->data(), lhs_len, rhs ? rhs->data() : nullptr, rhs_len, chunk, match, [&](const auto entt) {
+                func(entt, (rhs && rhs->contains(entt)) ? difference::value : difference::lhs_only);
+            });
+        }
+
+        if(rhs_len) {
+            internal::diff_each(rhs->data(), rhs_len, lhs ? lhs->data() : nullptr, lhs_len, chunk, [](auto...) { return true; }, [&](const auto entt) {
+                if(!(lhs && lhs->contains(entt))) {
+                    func(entt, difference::rhs_only);
+                }
+            });
+        }
+    }
+
+public:
+    /*! Basic registry type. */
+    using registry_type = Registry;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = typename registry_type::entity_type;
+
+    /**
+     * @brief Constructs an instance that is bound to two registries.
+     * @param lhs A valid reference to a registry.
+     * @param rhs A valid reference to a registry.
+     */
+    basic_registry_diff(const registry_type &lhs, const registry_type &rhs) noexcept
+        : left{&lhs},
+          right{&rhs} {}
+
+    /**
+     * @brief Compares the identifiers in use in both registries.
+     *
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const entity_type, const difference);
+     * @endcode
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     * @return An object of this type to continue comparing the registries.
+     */
+    template<typename Func>
+    const basic_registry_diff &entities(Func func) const {
+        const auto &lhs = *left->template storage<entity_type>();
+        const auto &rhs = *right->template storage<entity_type>();
+        const auto match = [](auto...) { return true; };
+
+        internal::diff_each(lhs.data(), lhs.free_list(), rhs.data(), rhs.free_list(), ENTT_PACKED_PAGE, match, [&](const auto entt) {
+            if(!right->valid(entt)) {
+                func(entt, difference::lhs_only);
+            }
+        });
+
+        internal::diff_each(rhs.data(), rhs.free_list(), lhs.data(), lhs.free_list(), ENTT_PACKED_PAGE, match, [&](const auto entt) {
+            if(!left->valid(entt)) {
+                func(entt, difference::rhs_only);
+            }
+        });
+
+        return *this;
+    }
+
+    /**
+     * @brief Compares all the pools of both registries, matched by name.
+     *
+     * Only the identifiers assigned to the pools are compared, elements are
+     * ignored. The signature of the function should be equivalent to the
+     * following:
+     *
+     * @code{.cpp}
+     * void(const id_type, const entity_type, const difference);
+     * @endcode
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     * @return An object of this type to continue comparing the registries.
+     */
+    template<typename Func>
+    const basic_registry_diff &storage(Func func) const {
+        const auto match = [](auto...) { return true; };
+
+        for(auto [id, pool]: left->storage()) {
+            each(&pool, right->storage(id), ENTT_PACKED_PAGE, match, [&func, id = id](const auto entt, const auto kind) {
+                if(kind != difference::value) {
+                    func(id, entt, kind);
+                }
+            });
+        }
+
+        for(auto [id, pool]: right->storage()) {
+            if(!left->storage(id)) {
+                each(static_cast<decltype(&pool)>(nullptr), &pool, ENTT_PACKED_PAGE, match, [&func, id = id](const auto entt, const auto kind) { func(id, entt, kind); });
+            }
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Compares the elements of a given type in both registries.
+     *
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const entity_type, const difference);
+     * @endcode
+     *
+     * @tparam Type Type of elements to compare.
+     * @tparam Func Type of the function object to invoke.
+     * @tparam Compare Type of the comparison function object.
+     * @param func A valid function object.
+     * @param compare A valid comparison function object.
+     * @param id Optional name used to map the storage within the registry.
+     * @return An object of this type to continue comparing the registries.
+     */
+    template<typename Type, typename Func, typename Compare = std::equal_to<Type>>
+    const basic_registry_diff &get(Func func, Compare compare = Compare{}, const id_type id = type_hash<Type>::value()) const {
+        static_assert(!std::is_same_v<Type, entity_type>, "Entity types not supported");
+        using storage_type = typename registry_type::template storage_for_type<Type>;
+        constexpr auto page_size = component_traits<Type>::page_size;
+
+        const auto *lhs = left->template storage<Type>(id);
+        const auto *rhs = right->template storage<Type>(id);
+
+        const auto match = [lhs, rhs](const std::size_t from, const std::size_t to) {
+            if constexpr(page_size == 0u) {
+                return true;
+            } else if constexpr(std::has_unique_object_representations_v<Type>) {
+                return std::memcmp(lhs->raw()[from / page_size], rhs->raw()[from / page_size], (to - from) * sizeof(Type)) == 0;
+            } else {
+                return false;
+            }
+        };
+
+        each<storage_type>(lhs, rhs, page_size ? page_size : ENTT_PACKED_PAGE, match, [&](const auto entt, const auto kind) {
+            if(kind != difference::value) {
+                func(entt, kind);
+            } else if constexpr(page_size != 0u) {
+                if(!compare(lhs->get(entt), rhs->get(entt))) {
+                    func(entt, kind);
+                }
+            }
+        });
+
+        return *this;
+    }
+
+private:
+    const registry_type *left;
+    const registry_type *right;
+};
+
+} // namespace entt
+
+#endif
@@ -0,0 +1,221 @@
+#ifndef ENTT_ENTITY_DOUBLE_BUFFER_HPP
+#define ENTT_ENTITY_DOUBLE_BUFFER_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <vector>
+#include "../config/config.h"
+#include "component.hpp"
+#include "fwd.hpp"
+
+namespace entt {
+
+/**
+ * @brief Read buffer of a storage that is updated one frame at a time.
+ *
+ * A double buffer keeps a copy of the content of a storage as it was at the
+ * time of the last commit. Readers access the copy while writers update the
+ * storage for the next frame. Committing only copies the pages that changed
+ * since the last commit.<br/>
+ * Pages are considered changed when elements are constructed or updated on
+ * them, or when the entities they contain differ from those of the copy. In
+ * particular, the latter covers moves due to deletions and sorting.
+ *
+ * @warning
+ * Changes made to the elements without going through `patch` or `replace`
+ * aren't detected. Moreover, commits must not overlap with reads.
+ *
+ * @warning
+ * Lifetime of a double buffer must not overcome that of the storage to which
+ * it is connected.
+ *
+ * @tparam Storage Type of storage to buffer.
+ */
+template<typename Storage>
+class basic_double_buffer {
+    static_assert(!std::is_const_v<Storage>, "Non-const storage type required");
+
+    using value_type_t = typename Storage::value_type;
+    using traits_type = component_traits<value_type_t>;
+    using alloc_traits = std::allocator_traits<typename Storage::allocator_type>;
+
+    static_assert(!traits_type::in_place_delete, "Stable types aren't supported");
+    static_assert(traits_type::page_size == 0u || std::is_copy_assignable_v<value_type_t>, "Copy assignable type required");
+
+    using entity_container_type = std::vector<typename Storage::entity_type, typename alloc_traits::template rebind_alloc<typename Storage::entity_type>>;
+    using element_container_type = std::vector<value_type_t, typename alloc_traits::template rebind_alloc<value_type_t>>;
+    using dirty_container_type = std::vector<bool, typename alloc_traits::template rebind_alloc<bool>>;
+
+    static constexpr auto page_size = (traits_type::page_size == 0u) ? ENTT_PACKED_PAGE : traits_type::page_size;
+
+    void touch(typename Storage::registry_type &, const typename Storage::entity_type entt) {
+        if(const auto page = storage->index(entt) / page_size; !(page < dirty.size())) {
+            dirty.resize(page + 1u, true);
+        } else {
+            dirty[page] = true;
+        }
+    }
+
+public:
+    /*! @brief Type of buffered storage. */
+    using storage_type = Storage;
+    /*! @brief Type of buffered elements. */
+    using value_type = value_type_t;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = typename storage_type::entity_type;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /**
+     * @brief Creates a double buffer and connects it to a given storage.
+     * @param source A valid reference to a storage.
+     */
+    basic_double_buffer(storage_type &source)
+        : entities{source.get_allocator()},
+          elements{source.get_allocator()},
+          dirty{source.get_allocator()},
+          storage{&source} {
+        storage->on_construct().template connect<&basic_double_buffer::touch>(*this);
+        storage->on_update().template connect<&basic_double_buffer::touch>(*this);
+    }
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    basic_double_buffer(const basic_double_buffer &) = delete;
+
+    /*! @brief Default move constructor, deleted on purpose. */
+    basic_double_buffer(basic_double_buffer &&) = delete;
+
+    /*! @brief Disconnects the double buffer from its storage. */
+    ~basic_double_buffer() {
+        storage->on_construct().disconnect(this);
+        storage->on_update().disconnect(this);
+    }
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This double buffer.
+     */
+    basic_double_buffer &operator=(const basic_double_buffer &) = delete;
+
+    /**
+     * @brief Default move assignment operator, deleted on purpose.
+     * @return This double buffer.
+     */
+    basic_double_buffer &operator=(basic_double_buffer &&) = delete;
+
+    /**
+     * @brief Copies the pages that changed since the last commit.
+     * @return The number of pages copied.
+     */
+    size_type commit() {
+        const auto length = storage->size();
+        const auto from = entities.size();
+        size_type count{};
+
+        entities.resize(length);
+
+        if constexpr(traits_type::page_size != 0u) {
+            // grows by copy, so that elements needn't be default constructible
+            for(; elements.size() > length; elements.pop_back()) {}
+            elements.reserve(length);
+
+            for(auto pos = elements.size(); pos < length; ++pos) {
+                elements.push_back(storage->raw()[pos / page_size][pos % page_size]);
+            }
+        }
+
+        for(size_type page{}, last = (length + page_size - 1u) / page_size; page < last; ++page) {
+            const auto offset = page * page_size;
+            const auto len = (length - offset) < page_size ? (length - offset) : page_size;
+            const auto *first = storage->data() + offset;
+
+            if((page < dirty.size() && dirty[page]) || (offset + len) > from || !std::equal(first, first + len, entities.data() + offset)) {
+                std::copy(first, first + len, entities.data() + offset);
+
+                if constexpr(traits_type::page_size != 0u) {
+                    const auto *data = storage->raw()[page];
+                    std::copy(data, data + len, elements.data() + offset);
+                }
+
+                ++count;
+            }
+        }
+
+        dirty.assign(dirty.size(), false);
+        return count;
+    }
+
+    /**
+     * @brief Returns the number of entities as of the last commit.
+     * @return Number of entities as of the last commit.
+     */
+    [[nodiscard]] size_type size() const noexcept {
+        return entities.size();
+    }
+
+    /**
+     * @brief Checks whether the buffer was empty as of the last commit.
+     * @return True if the buffer is empty, false otherwise.
+     */
+    [[nodiscard]] bool empty() const noexcept {
+        return entities.empty();
+    }
+
+    /**
+     * @brief Direct access to the entities as of the last commit.
+     * @return A pointer to the array of entities.
+     */
+    [[nodiscard]] const entity_type *data() const noexcept {
+        return entities.data();
+    }
+
+    /**
+     * @brief Direct access to the elements as of the last commit.
+     *
+     * Elements are laid out contiguously and in the same order of the
+     * entities. The returned pointer is null for empty types.
+     *
+     * @return A pointer to the array of elements.
+     */
+    [[nodiscard]] const value_type *raw() const noexcept {
+        return elements.data();
+    }
+
+    /**
+     * @brief Iterates entities and elements as of the last commit and applies
+     * the given function object to them.
+     *
+     * The signature of the function should be equivalent to one of the
+     * following (non-empty types only):
+     *
+     * @code{.cpp}
+     * void(const entity_type);
+     * void(const entity_type, const value_type &);
+     * @endcode
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each(Func func) const {
+        for(size_type pos{}, last = entities.size(); pos < last; ++pos) {
+            if constexpr(traits_type::page_size == 0u) {
+                func(entities[pos]);
+            } else {
+                func(entities[pos], elements[pos]);
+            }
+        }
+    }
+
+private:
+    entity_container_type entities;
+    element_container_type elements;
+    dirty_container_type dirty;
+    storage_type *storage;
+};
+
+} // namespace entt
+
+#endif
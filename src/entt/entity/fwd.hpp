@@ -28,6 +28,9 @@ class basic_sparse_set;
 template<typename Type, typename = entity, typename = std::allocator<Type>, typename = void>
 class basic_storage;
 
+template<typename Type, typename = entity>
+class basic_mirror;
+
 template<typename Type>
 class sigh_mixin;
 
@@ -84,12 +87,41 @@ class basic_group;
 template<typename, typename Mask = std::uint32_t, typename = std::allocator<Mask>>
 class basic_observer;
 
+template<typename>
+class basic_access_tracker;
+
+template<typename>
+class basic_double_buffer;
+
+template<typename>
+class basic_journal;
+
+template<typename>
+class basic_migration;
+
+class page_pool;
+
+template<typename>
+class page_allocator;
+
 template<typename>
 class basic_organizer;
 
 template<typename, typename...>
 struct basic_handle;
 
+template<typename>
+class basic_registry_diff;
+
+template<typename, typename>
+class basic_relation;
+
+template<typename>
+class basic_rollback;
+
+template<typename>
+class basic_sharded_registry;
+
 template<typename>
 class basic_snapshot;
 
@@ -193,9 +225,32 @@ using sparse_set = basic_sparse_set<>;
 template<typename Type>
 using storage = basic_storage<Type>;
 
+/**
+ * @brief Alias declaration for the most common use case.
+ * @tparam Type Type of objects assigned to the entities.
+ */
+template<typename Type>
+using mirror = basic_mirror<Type>;
+
+/**
+ * @brief Alias declaration for the most common use case.
+ * @tparam Type Type of objects assigned to the entities.
+ */
+template<typename Type>
+using double_buffer = basic_double_buffer<storage_type_t<Type>>;
+
 /*! @brief Alias declaration for the most common use case. */
 using registry = basic_registry<>;
 
+/*! @brief Alias declaration for the most common use case. */
+using access_tracker = basic_access_tracker<registry>;
+
+/*! @brief Alias declaration for the most common use case. */
+using journal = basic_journal<registry>;
+
+/*! @brief Alias declaration for the most common use case. */
+using migration = basic_migration<registry>;
+
 /*! @brief Alias declaration for the most common use case. */
 using observer = basic_observer<registry>;
 
@@ -222,6 +277,22 @@ using handle_view = basic_handle<registry, Args...>;
 template<typename... Args>
 using const_handle_view = basic_handle<const registry, Args...>;
 
+/*! @brief Alias declaration for the most common use case. */
+using registry_diff = basic_registry_diff<registry>;
+
+/**
+ * @brief Alias declaration for the most common use case.
+ * @tparam Kind Type used to tell relations apart.
+ */
+template<typename Kind>
+using relation = basic_relation<Kind, registry>;
+
+/*! @brief Alias declaration for the most common use case. */
+using rollback = basic_rollback<registry>;
+
+/*! @brief Alias declaration for the most common use case. */
+using sharded_registry = basic_sharded_registry<registry>;
+
 /*! @brief Alias declaration for the most common use case. */
 using snapshot = basic_snapshot<registry>;
 
@@ -1,9 +1,14 @@
 #ifndef ENTT_ENTITY_HELPER_HPP
 #define ENTT_ENTITY_HELPER_HPP
 
+#include <cstddef>
 #include <memory>
+#include <optional>
+#include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
+#include "../config/config.h"
 #include "../core/fwd.hpp"
 #include "../core/type_traits.hpp"
 #include "../signal/delegate.hpp"
@@ -14,6 +19,50 @@
 
 namespace entt {
 
+/**
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
+ */
+
+namespace internal {
+
+struct sequential_dispatcher {
+    template<typename Task>
+    void operator()(const std::size_t count, Task task) const {
+        for(std::size_t pos{}; pos < count; ++pos) {
+            task(pos);
+        }
+    }
+};
+
+template<typename View>
+[[nodiscard]] std::size_t chunk_count(const View &view) noexcept {
+    const auto *leading = view.handle();
+    return leading ? ((leading->size() + ENTT_PACKED_PAGE - 1u) / ENTT_PACKED_PAGE) : 0u;
+}
+
+template<typename View, typename Func>
+void each_in_chunk(const View &view, const std::size_t chunk, Func func) {
+    using difference_type = typename std::remove_pointer_t<decltype(view.handle())>::iterator::difference_type;
+    const auto *leading = view.handle();
+    const auto length = leading->size();
+    const auto from = chunk * ENTT_PACKED_PAGE;
+    const auto to = ((length - from) < ENTT_PACKED_PAGE) ? length : (from + ENTT_PACKED_PAGE);
+
+    for(auto first = leading->end() - static_cast<difference_type>(to), last = leading->end() - static_cast<difference_type>(from); first != last; ++first) {
+        if(const auto entt = *first; view.contains(entt)) {
+            std::apply(func, std::tuple_cat(std::make_tuple(entt), view.get(entt)));
+        }
+    }
+}
+
+} // namespace internal
+
+/**
+ * Internal details not to be documented.
+ * @endcond
+ */
+
 /**
  * @brief Converts a registry to a view.
  * @tparam Registry Basic registry type.
@@ -156,6 +205,139 @@ template<typename... Args, typename Component>
     return null;
 }
 
+/**
+ * @brief Splits the elements of a storage in page aligned ranges.
+ *
+ * Ranges are as balanced as possible and pages are never split across them.
+ * Workers that only touch their ranges never share a page of elements, which
+ * avoids false sharing and lets memory be placed close to the node that uses
+ * it, as in the case of a first-touch allocation policy.<br/>
+ * The signature of the function should be equivalent to the following:
+ *
+ * @code{.cpp}
+ * void(const std::size_t part, typename Storage::iterator first, typename Storage::iterator last);
+ * @endcode
+ *
+ * Some ranges may be empty if there are more parts than pages.
+ *
+ * @tparam Storage Type of storage to split.
+ * @tparam Func Type of the function object to invoke.
+ * @param storage A storage to split.
+ * @param count The number of ranges to create.
+ * @param func A valid function object.
+ */
+template<typename Storage, typename Func>
+void partition(Storage &storage, const std::size_t count, Func func) {
+    constexpr auto page_size = (Storage::traits_type::page_size == 0u) ? std::size_t{ENTT_PACKED_PAGE} : std::size_t{Storage::traits_type::page_size};
+    const auto length = storage.size();
+    const auto pages = (length + page_size - 1u) / page_size;
+
+    for(std::size_t pos{}; pos < count; ++pos) {
+        const auto first = (pages * pos / count) * page_size;
+        const auto last = (pages * (pos + 1u) / count) * page_size;
+        const auto from = (first < length) ? first : length;
+        const auto to = (last < length) ? last : length;
+        // iterators visit elements from the last to the first, that is, from the end of the range
+        func(pos, storage.end() - static_cast<typename Storage::iterator::difference_type>(to), storage.end() - static_cast<typename Storage::iterator::difference_type>(from));
+    }
+}
+
+/**
+ * @brief Applies a function object to the entities of a view, one chunk at a
+ * time.
+ *
+ * Chunks are ranges of `ENTT_PACKED_PAGE` positions in the leading storage of
+ * the view. Their boundaries don't depend on the number of threads nor on the
+ * way chunks are scheduled.<br/>
+ * Chunks are handed to a dispatcher, that is a function object that receives
+ * the number of chunks and a task to invoke once per chunk, possibly from
+ * different threads. The signature of the dispatcher should be equivalent to
+ * the following:
+ *
+ * @code{.cpp}
+ * void(const std::size_t count, Task task);
+ * @endcode
+ *
+ * The default dispatcher runs all tasks on the calling thread. The function
+ * object is invoked with an entity followed by its elements, exactly as in the
+ * case of `each`.
+ *
+ * @tparam View Type of view to iterate.
+ * @tparam Func Type of the function object to invoke.
+ * @tparam Exec Type of dispatcher to use.
+ * @param view A view to iterate.
+ * @param func A valid function object.
+ * @param exec A valid dispatcher.
+ */
+template<typename View, typename Func, typename Exec = internal::sequential_dispatcher>
+void parallel_for(const View &view, Func func, Exec exec = {}) {
+    exec(internal::chunk_count(view), [&view, &func](const std::size_t chunk) {
+        internal::each_in_chunk(view, chunk, func);
+    });
+}
+
+/**
+ * @brief Reduces the entities of a view, one chunk at a time.
+ *
+ * Chunks are the same as for `parallel_for`. Each chunk maps and combines its
+ * entities in order, then partial results are combined pairwise along a tree
+ * the shape of which only depends on the number of chunks. Finally, the
+ * initial value is combined with the result.<br/>
+ * Therefore, the result is the same no matter the number of threads or the way
+ * chunks are scheduled, floating point types included.
+ *
+ * The signatures of the mapping and combining functions should be equivalent
+ * to the following:
+ *
+ * @code{.cpp}
+ * Type(const entity_type, Elem &...);
+ * Type(Type, Type);
+ * @endcode
+ *
+ * @tparam View Type of view to iterate.
+ * @tparam Type Type of the result.
+ * @tparam Map Type of the mapping function.
+ * @tparam Combine Type of the combining function.
+ * @tparam Exec Type of dispatcher to use.
+ * @param view A view to iterate.
+ * @param init The initial value.
+ * @param map A valid mapping function.
+ * @param combine A valid combining function.
+ * @param exec A valid dispatcher.
+ * @return The result of the reduction.
+ */
+template<typename View, typename Type, typename Map, typename Combine, typename Exec = internal::sequential_dispatcher>
+[[nodiscard]] Type parallel_reduce(const View &view, Type init, Map map, Combine combine, Exec exec = {}) {
+    const auto count = internal::chunk_count(view);
+    std::vector<std::optional<Type>> partial(count);
+
+    exec(count, [&](const std::size_t chunk) {
+        internal::each_in_chunk(view, chunk, [&acc = partial[chunk], &map, &combine](auto &&...args) {
+            if(acc) {
+                *acc = combine(std::move(*acc), map(args...));
+            } else {
+                acc.emplace(map(args...));
+            }
+        });
+    });
+
+    for(std::size_t step = 1u; step < count; step *= 2u) {
+        for(std::size_t pos{}; (pos + step) < count; pos += 2u * step) {
+            if(auto &other = partial[pos + step]; other && partial[pos]) {
+                *partial[pos] = combine(std::move(*partial[pos]), std::move(*other));
+            } else if(other) {
+                partial[pos] = std::move(other);
+            }
+        }
+    }
+
+    if(count != 0u && partial[0u]) {
+        return combine(std::move(init), std::move(*partial[0u]));
+    }
+
+    return init;
+}
+
 /*! @brief Primary template isn't defined on purpose. */
 template<typename...>
 struct sigh_helper;
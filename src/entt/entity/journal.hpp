@@ -0,0 +1,300 @@
+#ifndef ENTT_ENTITY_JOURNAL_HPP
+#define ENTT_ENTITY_JOURNAL_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "../container/dense_map.hpp"
+#include "../core/fwd.hpp"
+#include "../core/type_info.hpp"
+#include "../core/utility.hpp"
+#include "component.hpp"
+#include "fwd.hpp"
+
+namespace entt {
+
+/**
+ * @brief Write-ahead log of the changes made to a registry.
+ *
+ * A journal records entity creation and destruction as well as construction,
+ * update and destruction of the elements of the types it watches. Records are
+ * appended to an internal buffer and handed to the caller in a single batch
+ * when committed, so that writes to disk can be grouped.<br/>
+ * Replaying a journal on top of the snapshot from which it started brings a
+ * registry back to the state it had at the time of the last commit.
+ *
+ * Records are made of an operation, the name of the storage, the entity and,
+ * for construction and update only, the bytes of the element. Therefore, only
+ * trivially copyable types are supported and journals aren't portable across
+ * platforms with a different byte order.
+ *
+ * @warning
+ * Lifetime of a journal doesn't necessarily have to overcome that of the
+ * registry to which it is connected. However, the journal must be disconnected
+ * from the registry before being destroyed to avoid crashes due to dangling
+ * pointers.
+ *
+ * @tparam Registry Basic registry type.
+ */
+template<typename Registry>
+class basic_journal {
+    static_assert(!std::is_const_v<Registry>, "Non-const registry type required");
+    using alloc_traits = std::allocator_traits<typename Registry::allocator_type>;
+
+    enum class operation : std::uint8_t {
+        create,
+        destroy,
+        construct,
+        update,
+        erase
+    };
+
+    struct handler_type {
+        basic_journal *owner;
+        id_type id;
+        std::size_t length;
+        void (*replay)(Registry &, const operation, const id_type, const typename Registry::entity_type, const std::byte *);
+        void (*disconnect)(Registry &, handler_type &);
+    };
+
+    static constexpr std::size_t header_size = sizeof(operation) + sizeof(id_type) + sizeof(typename Registry::entity_type);
+
+    void append(const operation op, const id_type id, const typename Registry::entity_type entt, const void *elem, const std::size_t length) {
+        if(!replaying) {
+            const auto pos = buffer.size();
+            buffer.resize(pos + header_size + length);
+            auto *ptr = buffer.data() + pos;
+
+            std::memcpy(ptr, &op, sizeof(op));
+            std::memcpy(ptr + sizeof(op), &id, sizeof(id));
+            std::memcpy(ptr + sizeof(op) + sizeof(id), &entt, sizeof(entt));
+
+            if(length != 0u) {
+                std::memcpy(ptr + header_size, elem, length);
+            }
+        }
+    }
+
+    template<operation Op>
+    void track(Registry &, const typename Registry::entity_type entt) {
+        append(Op, id_type{}, entt, nullptr, 0u);
+    }
+
+    template<typename Type, operation Op>
+    static void record(handler_type &handler, Registry &reg, const typename Registry::entity_type entt) {
+        if constexpr(Op == operation::erase || component_traits<Type>::page_size == 0u) {
+            handler.owner->append(Op, handler.id, entt, nullptr, 0u);
+        } else {
+            handler.owner->append(Op, handler.id, entt, &reg.template storage<Type>(handler.id).get(entt), sizeof(Type));
+        }
+    }
+
+    template<typename Type>
+    static void replay(Registry &reg, const operation op, const id_type id, const typename Registry::entity_type entt, const std::byte *data) {
+        auto &storage = reg.template storage<Type>(id);
+
+        if(op == operation::erase) {
+            storage.remove(entt);
+        } else if constexpr(component_traits<Type>::page_size == 0u) {
+            if(!storage.contains(entt)) {
+                storage.emplace(entt);
+            }
+        } else {
+            Type elem{};
+            std::memcpy(&elem, data, sizeof(Type));
+
+            if(storage.contains(entt)) {
+                storage.patch(entt, [&elem](auto &curr) { curr = elem; });
+            } else {
+                storage.emplace(entt, elem);
+            }
+        }
+    }
+
+    template<typename Type>
+    static void disconnect(Registry &reg, handler_type &handler) {
+        reg.template on_construct<Type>(handler.id).disconnect(&handler);
+        reg.template on_update<Type>(handler.id).disconnect(&handler);
+        reg.template on_destroy<Type>(handler.id).disconnect(&handler);
+    }
+
+public:
+    /*! Basic registry type. */
+    using registry_type = Registry;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = typename registry_type::entity_type;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /**
+     * @brief Creates a journal and connects it to a given registry.
+     * @param source A valid reference to a registry.
+     */
+    basic_journal(registry_type &source)
+        : buffer{source.get_allocator()},
+          handlers{source.get_allocator()},
+          reg{&source},
+          replaying{} {
+        reg->template on_construct<entity_type>().template connect<&basic_journal::track<operation::create>>(*this);
+        reg->template on_destroy<entity_type>().template connect<&basic_journal::track<operation::destroy>>(*this);
+    }
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    basic_journal(const basic_journal &) = delete;
+
+    /*! @brief Default move constructor, deleted on purpose. */
+    basic_journal(basic_journal &&) = delete;
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This journal.
+     */
+    basic_journal &operator=(const basic_journal &) = delete;
+
+    /**
+     * @brief Default move assignment operator, deleted on purpose.
+     * @return This journal.
+     */
+    basic_journal &operator=(basic_journal &&) = delete;
+
+    /**
+     * @brief Records the changes made to the elements of a given type.
+     * @tparam Type Type of elements to keep track of.
+     * @param id Optional name used to map the storage within the registry.
+     * @return A non-const reference to this journal.
+     */
+    template<typename Type>
+    basic_journal &watch(const id_type id = type_hash<Type>::value()) {
+        static_assert(std::is_trivially_copyable_v<Type> && std::is_default_constructible_v<Type>, "Trivially copyable and default constructible type required");
+        ENTT_ASSERT(reg != nullptr, "Journal not connected");
+        ENTT_ASSERT(!handlers.contains(id), "Storage already watched");
+
+        const auto length = (component_traits<Type>::page_size == 0u) ? 0u : sizeof(Type);
+        auto &handler = *handlers.emplace(id, std::make_unique<handler_type>(handler_type{this, id, length, &replay<Type>, &disconnect<Type>})).first->second;
+
+        reg->template on_construct<Type>(id).template connect<&record<Type, operation::construct>>(handler);
+        reg->template on_update<Type>(id).template connect<&record<Type, operation::update>>(handler);
+        reg->template on_destroy<Type>(id).template connect<&record<Type, operation::erase>>(handler);
+
+        return *this;
+    }
+
+    /*! @brief Disconnects a journal from the registry it keeps track of. */
+    void disconnect() {
+        if(reg) {
+            reg->template on_construct<entity_type>().disconnect(this);
+            reg->template on_destroy<entity_type>().disconnect(this);
+
+            for(auto &&elem: handlers) {
+                elem.second->disconnect(*reg, *elem.second);
+            }
+
+            handlers.clear();
+            reg = nullptr;
+        }
+    }
+
+    /**
+     * @brief Returns the number of bytes recorded since the last commit.
+     * @return Number of bytes recorded since the last commit.
+     */
+    [[nodiscard]] size_type size() const noexcept {
+        return buffer.size();
+    }
+
+    /**
+     * @brief Checks whether a journal has records to commit.
+     * @return True if the journal has no records to commit, false otherwise.
+     */
+    [[nodiscard]] bool empty() const noexcept {
+        return buffer.empty();
+    }
+
+    /**
+     * @brief Hands all the records since the last commit to an archive.
+     *
+     * The archive is invoked once per commit and must be equivalent to the
+     * following:
+     *
+     * @code{.cpp}
+     * void(const std::byte *data, const std::size_t length);
+     * @endcode
+     *
+     * @tparam Archive Type of output archive.
+     * @param archive A valid reference to an output archive.
+     */
+    template<typename Archive>
+    void commit(Archive &&archive) {
+        if(!buffer.empty()) {
+            archive(std::as_const(buffer).data(), buffer.size());
+            buffer.clear();
+        }
+    }
+
+    /**
+     * @brief Applies the records of a journal to the registry.
+     *
+     * Types must be watched before replaying their records. No records are
+     * taken for the changes made while replaying.<br/>
+     * Replay stops at the first incomplete record, if any. This happens when
+     * the tail of a journal wasn't written entirely to disk.
+     *
+     * @param data The records to apply.
+     * @param length The number of bytes available.
+     * @return The number of bytes consumed.
+     */
+    size_type replay(const std::byte *data, const size_type length) {
+        ENTT_ASSERT(reg != nullptr, "Journal not connected");
+        size_type pos{};
+
+        for(replaying = true; (length - pos) >= header_size;) {
+            operation op{};
+            id_type id{};
+            entity_type entt{};
+
+            std::memcpy(&op, data + pos, sizeof(op));
+            std::memcpy(&id, data + pos + sizeof(op), sizeof(id));
+            std::memcpy(&entt, data + pos + sizeof(op) + sizeof(id), sizeof(entt));
+
+            if(op == operation::create) {
+                [[maybe_unused]] const auto other = reg->create(entt);
+                ENTT_ASSERT(other == entt, "Entity not available");
+            } else if(op == operation::destroy) {
+                reg->destroy(entt);
+            } else if(const auto it = handlers.find(id); it != handlers.end()) {
+                const auto size = (op == operation::erase) ? 0u : it->second->length;
+
+                if((length - pos - header_size) < size) {
+                    break;
+                }
+
+                it->second->replay(*reg, op, id, entt, data + pos + header_size);
+                pos += size;
+            } else {
+                ENTT_ASSERT(false, "Storage not watched");
+                break;
+            }
+
+            pos += header_size;
+        }
+
+        replaying = false;
+        return pos;
+    }
+
+private:
+    std::vector<std::byte, typename alloc_traits::template rebind_alloc<std::byte>> buffer;
+    dense_map<id_type, std::unique_ptr<handler_type>, identity, std::equal_to<id_type>, typename alloc_traits::template rebind_alloc<std::pair<const id_type, std::unique_ptr<handler_type>>>> handlers;
+    registry_type *reg;
+    bool replaying;
+};
+
+} // namespace entt
+
+#endif
@@ -0,0 +1,209 @@
+#ifndef ENTT_ENTITY_MIGRATION_HPP
+#define ENTT_ENTITY_MIGRATION_HPP
+
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "../container/dense_map.hpp"
+#include "../core/fwd.hpp"
+#include "../core/type_info.hpp"
+#include "entity.hpp"
+#include "fwd.hpp"
+
+namespace entt {
+
+/**
+ * @brief Utility class to move entities from a registry to another.
+ *
+ * A migration creates counterparts in the destination registry for a set of
+ * entities of the source registry, then moves their elements one storage at a
+ * time. Elements are moved rather than copied and removed from the source
+ * registry in bulk once moved.<br/>
+ * Members are either data members of type entity_type or containers of
+ * entities. In both cases, a migration visits them and replaces entities with
+ * their counterparts. Entities that aren't part of the migration are left
+ * unchanged.
+ *
+ * @tparam Registry Basic registry type.
+ */
+template<typename Registry>
+class basic_migration {
+    static_assert(!std::is_const_v<Registry>, "Non-const registry type required");
+    using alloc_traits = std::allocator_traits<typename Registry::allocator_type>;
+    using container_type = std::vector<typename Registry::entity_type, typename alloc_traits::template rebind_alloc<typename Registry::entity_type>>;
+    using remloc_type = dense_map<typename Registry::entity_type, typename Registry::entity_type, std::hash<typename Registry::entity_type>, std::equal_to<typename Registry::entity_type>, typename alloc_traits::template rebind_alloc<std::pair<const typename Registry::entity_type, typename Registry::entity_type>>>;
+
+    [[nodiscard]] auto remap(const typename Registry::entity_type entt) const noexcept {
+        const auto it = remloc.find(entt);
+        return (it == remloc.cend()) ? entt : it->second;
+    }
+
+    template<typename Member>
+    void update(Member &member) const {
+        if constexpr(std::is_same_v<Member, entity_type>) {
+            member = remap(member);
+        } else {
+            // maybe a container? let's try...
+            static_assert(std::is_same_v<typename Member::value_type, entity_type>, "Invalid value type");
+
+            for(auto &&entt: member) {
+                entt = remap(entt);
+            }
+        }
+    }
+
+public:
+    /*! Basic registry type. */
+    using registry_type = Registry;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = typename registry_type::entity_type;
+
+    /**
+     * @brief Constructs an instance that is bound to two registries.
+     * @param source A valid reference to the registry to move entities from.
+     * @param destination A valid reference to the registry to move entities to.
+     */
+    basic_migration(registry_type &source, registry_type &destination) noexcept
+        : remloc{source.get_allocator()},
+          src{&source},
+          dst{&destination} {}
+
+    /*! @brief Default move constructor. */
+    basic_migration(basic_migration &&) = default;
+
+    /*! @brief Default move assignment operator. @return This migration. */
+    basic_migration &operator=(basic_migration &&) = default;
+
+    /**
+     * @brief Creates counterparts in the destination registry for a range of
+     * entities.
+     *
+     * Identifiers are generated in bulk as if by `create`.
+     *
+     * @tparam It Type of forward iterator.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @return A valid migration to continue moving elements.
+     */
+    template<typename It>
+    basic_migration &entities(It first, It last) {
+        container_type local(static_cast<typename container_type::size_type>(std::distance(first, last)), entity_type{null}, src->get_allocator());
+        dst->create(local.begin(), local.end());
+        remloc.reserve(remloc.size() + local.size());
+
+        for(auto it = local.cbegin(); first != last; ++first, ++it) {
+            ENTT_ASSERT(src->valid(*first), "Invalid entity");
+            ENTT_ASSERT(!contains(*first), "Entity already migrated");
+            remloc.emplace(*first, *it);
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Moves all elements of a type that belong to migrated entities.
+     *
+     * Elements are move constructed in the destination registry and then
+     * removed from the source registry in a batch.
+     *
+     * @tparam Type Type of elements to move.
+     * @tparam Member Members to update with their counterparts.
+     * @param id Optional name used to map the storage within both registries.
+     * @return A valid migration to continue moving elements.
+     */
+    template<typename Type, auto... Member>
+    basic_migration &get(const id_type id = type_hash<Type>::value()) {
+        static_assert(!std::is_same_v<Type, entity_type>, "Entity types not supported");
+        auto &from = src->template storage<Type>(id);
+        auto &to = dst->template storage<Type>(id);
+        container_type entity{src->get_allocator()};
+
+        if(const typename registry_type::common_type &base = from; base.size() < remloc.size()) {
+            for(const auto entt: base) {
+                if(contains(entt)) {
+                    entity.push_back(entt);
+                }
+            }
+        } else {
+            for(auto &&elem: remloc) {
+                if(from.contains(elem.first)) {
+                    entity.push_back(elem.first);
+                }
+            }
+        }
+
+        to.reserve(to.size() + entity.size());
+
+        for(const auto entt: entity) {
+            if constexpr(std::remove_reference_t<decltype(to)>::traits_type::page_size == 0u) {
+                to.emplace(map(entt));
+            } else {
+                auto &elem = to.emplace(map(entt), std::move(from.get(entt)));
+                (update(elem.*Member), ...);
+            }
+        }
+
+        using iterator_type = typename registry_type::common_type::iterator;
+        // cross iterators let the storage take its bulk erase path
+        from.erase(iterator_type{entity, static_cast<typename iterator_type::difference_type>(entity.size())}, iterator_type{entity, 0});
+        return *this;
+    }
+
+    /**
+     * @brief Destroys migrated entities in the source registry.
+     *
+     * Elements that weren't moved are destroyed along with their entities. The
+     * identifiers of the counterparts are still available afterwards.
+     *
+     * @return A valid migration to continue moving elements.
+     */
+    basic_migration &destroy() {
+        container_type entity{src->get_allocator()};
+        entity.reserve(remloc.size());
+
+        for(auto &&elem: remloc) {
+            if(src->valid(elem.first)) {
+                entity.push_back(elem.first);
+            }
+        }
+
+        src->destroy(entity.begin(), entity.end());
+        return *this;
+    }
+
+    /**
+     * @brief Tests if a migration knows about a given entity.
+     * @param entt A valid identifier.
+     * @return True if `entity` is managed by the migration, false otherwise.
+     */
+    [[nodiscard]] bool contains(entity_type entt) const noexcept {
+        return remloc.contains(entt);
+    }
+
+    /**
+     * @brief Returns the identifier to which an entity refers.
+     * @param entt A valid identifier.
+     * @return The counterpart in the destination registry if any, the null
+     * entity otherwise.
+     */
+    [[nodiscard]] entity_type map(entity_type entt) const noexcept {
+        if(const auto it = remloc.find(entt); it != remloc.cend()) {
+            return it->second;
+        }
+
+        return null;
+    }
+
+private:
+    remloc_type remloc;
+    registry_type *src;
+    registry_type *dst;
+};
+
+} // namespace entt
+
+#endif
@@ -0,0 +1,197 @@
+#ifndef ENTT_ENTITY_MIRROR_HPP
+#define ENTT_ENTITY_MIRROR_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include "../config/config.h"
+#include "component.hpp"
+#include "fwd.hpp"
+
+namespace entt {
+
+/**
+ * @brief Copy of a storage laid out in a user provided memory region.
+ *
+ * A mirror is meant to share the content of a storage with other processes,
+ * for example through a shared memory region. Its layout doesn't contain any
+ * pointer and therefore the region can be mapped at different addresses in
+ * different processes.<br/>
+ * There is a single writer that publishes the content of a storage and any
+ * number of readers that access it in place, without copies. Reads are made
+ * consistent by means of a sequence counter stored in the region itself.
+ *
+ * The region is made of a small header followed by the packed array of
+ * identifiers and the array of elements, in this order. Tombstones aren't
+ * removed and readers must skip them, if any.
+ *
+ * @warning
+ * The memory region must be suitably aligned for the header, the identifiers
+ * and the elements.
+ *
+ * @tparam Type Element type.
+ * @tparam Entity A valid entity type.
+ */
+template<typename Type, typename Entity>
+class basic_mirror {
+    static_assert(std::is_trivially_copyable_v<Type>, "Trivially copyable type required");
+    static_assert(std::atomic<std::uint32_t>::is_always_lock_free && std::atomic<std::size_t>::is_always_lock_free, "Lock free atomics required");
+
+    struct header_type {
+        std::atomic<std::uint32_t> sequence;
+        std::atomic<std::size_t> count;
+    };
+
+    static constexpr auto page_size = component_traits<Type>::page_size;
+
+    [[nodiscard]] static constexpr std::size_t align(const std::size_t offset, const std::size_t alignment) noexcept {
+        return (offset + alignment - 1u) / alignment * alignment;
+    }
+
+    [[nodiscard]] static constexpr std::size_t entities_offset() noexcept {
+        return align(sizeof(header_type), alignof(Entity));
+    }
+
+    [[nodiscard]] static constexpr std::size_t elements_offset(const std::size_t count) noexcept {
+        return align(entities_offset() + count * sizeof(Entity), alignof(Type));
+    }
+
+public:
+    /*! @brief Element type. */
+    using value_type = Type;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /**
+     * @brief Returns the size of the region required for a given number of
+     * elements.
+     * @param count Number of elements.
+     * @return The size in bytes of the region.
+     */
+    [[nodiscard]] static constexpr size_type required_size(const size_type count) noexcept {
+        return page_size == 0u ? (entities_offset() + count * sizeof(Entity)) : (elements_offset(count) + count * sizeof(Type));
+    }
+
+    /**
+     * @brief Binds a mirror to a memory region.
+     * @param memory A valid pointer to the memory region.
+     * @param length The size in bytes of the memory region.
+     */
+    basic_mirror(void *memory, const size_type length) noexcept
+        : region{static_cast<std::byte *>(memory)},
+          size{length} {
+        ENTT_ASSERT(length >= sizeof(header_type), "Region too small");
+    }
+
+    /**
+     * @brief Initializes the memory region.
+     *
+     * Only the writer invokes this function, once and before the first
+     * publication.
+     */
+    void reset() noexcept {
+        auto *header = ::new(region) header_type{};
+        header->count.store(0u, std::memory_order_relaxed);
+        header->sequence.store(0u, std::memory_order_release);
+    }
+
+    /**
+     * @brief Publishes the content of a storage.
+     *
+     * Identifiers are copied at once, elements a page at a time.
+     *
+     * @tparam Storage Type of storage to publish.
+     * @param storage A storage of elements of the right type.
+     * @return True if the storage fits the region and was published, false
+     * otherwise.
+     */
+    template<typename Storage>
+    bool publish(const Storage &storage) noexcept {
+        static_assert(std::is_same_v<typename Storage::value_type, Type>, "Invalid value type");
+        const auto count = storage.size();
+
+        if(required_size(count) > size) {
+            return false;
+        }
+
+        auto &header = *std::launder(reinterpret_cast<header_type *>(region));
+        const auto sequence = header.sequence.load(std::memory_order_relaxed);
+
+        // odd values tell readers that a publication is in progress
+        header.sequence.store(sequence + 1u, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        if(count != 0u) {
+            std::memcpy(region + entities_offset(), storage.data(), count * sizeof(Entity));
+
+            if constexpr(page_size != 0u) {
+                for(size_type pos{}, last = (count + page_size - 1u) / page_size; pos < last; ++pos) {
+                    const auto length = ((pos + 1u) == last) ? (count - pos * page_size) : page_size;
+                    std::memcpy(region + elements_offset(count) + pos * page_size * sizeof(Type), storage.raw()[pos], length * sizeof(Type));
+                }
+            }
+        }
+
+        header.count.store(count, std::memory_order_relaxed);
+        header.sequence.store(sequence + 2u, std::memory_order_release);
+
+        return true;
+    }
+
+    /**
+     * @brief Accesses the content of the region in place.
+     *
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const entity_type *entities, const value_type *elements, const size_type count);
+     * @endcode
+     *
+     * Elements are null for empty types.<br/>
+     * The function may observe a publication in progress. In this case, the
+     * return value is false and whatever the function did should be discarded.
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     * @return True if the read was consistent, false otherwise.
+     */
+    template<typename Func>
+    bool read(Func func) const {
+        const auto &header = *std::launder(reinterpret_cast<const header_type *>(region));
+        const auto sequence = header.sequence.load(std::memory_order_acquire);
+
+        if(sequence % 2u != 0u) {
+            return false;
+        }
+
+        const auto count = header.count.load(std::memory_order_relaxed);
+
+        if(required_size(count) > size) {
+            return false;
+        }
+
+        const auto *entities = reinterpret_cast<const entity_type *>(region + entities_offset());
+
+        if constexpr(page_size == 0u) {
+            func(entities, static_cast<const value_type *>(nullptr), count);
+        } else {
+            func(entities, reinterpret_cast<const value_type *>(region + elements_offset(count)), count);
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return header.sequence.load(std::memory_order_relaxed) == sequence;
+    }
+
+private:
+    std::byte *region;
+    size_type size;
+};
+
+} // namespace entt
+
+#endif
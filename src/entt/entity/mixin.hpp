@@ -1,6 +1,7 @@
 #ifndef ENTT_ENTITY_MIXIN_HPP
 #define ENTT_ENTITY_MIXIN_HPP
 
+#include <memory>
 #include <type_traits>
 #include <utility>
 #include "../config/config.h"
@@ -8,6 +9,7 @@
 #include "../signal/sigh.hpp"
 #include "entity.hpp"
 #include "fwd.hpp"
+#include "sparse_set.hpp"
 
 namespace entt {
 
@@ -42,6 +44,7 @@ class sigh_mixin final: public Type {
         } else {
             for(; first != last; ++first) {
                 const auto entt = *first;
+                ENTT_INSTRUMENT(++this->counters().publishes);
                 destruction.publish(reg, entt);
                 const auto it = underlying_type::find(entt);
                 underlying_type::pop(it, it + 1u);
@@ -53,13 +56,16 @@ class sigh_mixin final: public Type {
         if(auto &reg = owner_or_assert(); !destruction.empty()) {
             for(auto it = underlying_type::base_type::begin(0), last = underlying_type::base_type::end(0); it != last; ++it) {
                 if constexpr(std::is_same_v<typename underlying_type::value_type, typename underlying_type::entity_type>) {
+                    ENTT_INSTRUMENT(++this->counters().publishes);
                     destruction.publish(reg, *it);
                 } else {
                     if(underlying_type::traits_type::in_place_delete) {
                         if(const auto entt = *it; entt != tombstone) {
+                            ENTT_INSTRUMENT(++this->counters().publishes);
                             destruction.publish(reg, entt);
                         }
                     } else {
+                        ENTT_INSTRUMENT(++this->counters().publishes);
                         destruction.publish(reg, *it);
                     }
                 }
@@ -72,13 +78,40 @@ class sigh_mixin final: public Type {
     underlying_iterator try_emplace(const typename underlying_type::entity_type entt, const bool force_back, const void *value) final {
         const auto it = underlying_type::try_emplace(entt, force_back, value);
 
-        if(auto &reg = owner_or_assert(); it != underlying_type::base_type::end()) {
+        if(auto &reg = owner_or_assert(); !batching && it != underlying_type::base_type::end()) {
+            ENTT_INSTRUMENT(this->counters().publishes += !construction.empty());
             construction.publish(reg, *it);
         }
 
         return it;
     }
 
+    underlying_iterator try_insert(const underlying_iterator first, const underlying_iterator last, const void *value) final {
+        // underlying types may fall back to emplacing one entity at a time
+        batching = true;
+        underlying_iterator it{};
+
+        ENTT_TRY {
+            it = underlying_type::try_insert(first, last, value);
+        }
+        ENTT_CATCH {
+            batching = false;
+            ENTT_THROW;
+        }
+
+        batching = false;
+
+        if(auto &reg = owner_or_assert(); it != underlying_type::base_type::end() && !construction.empty()) {
+            // signals are sent in a batch once all elements are in place
+            for(auto curr = first; curr != last; ++curr) {
+                ENTT_INSTRUMENT(++this->counters().publishes);
+                construction.publish(reg, *curr);
+            }
+        }
+
+        return it;
+    }
+
 public:
     /*! @brief Allocator type. */
     using allocator_type = typename underlying_type::allocator_type;
@@ -125,6 +158,21 @@ public:
           destruction{std::move(other.destruction), allocator},
           update{std::move(other.update), allocator} {}
 
+    /**
+     * @brief Allocator-extended copy constructor.
+     *
+     * Listeners aren't copied and the storage isn't bound to any registry.
+     *
+     * @param other The instance to copy from.
+     * @param allocator The allocator to use.
+     */
+    sigh_mixin(const sigh_mixin &other, const allocator_type &allocator)
+        : underlying_type{other, allocator},
+          owner{},
+          construction{allocator},
+          destruction{allocator},
+          update{allocator} {}
+
     /**
      * @brief Move assignment operator.
      * @param other The instance to move from.
@@ -208,6 +256,7 @@ public:
      */
     auto emplace() {
         const auto entt = underlying_type::emplace();
+        ENTT_INSTRUMENT(this->counters().publishes += !construction.empty());
         construction.publish(owner_or_assert(), entt);
         return entt;
     }
@@ -228,10 +277,12 @@ public:
     decltype(auto) emplace(const entity_type hint, Args &&...args) {
         if constexpr(std::is_same_v<typename underlying_type::value_type, typename underlying_type::entity_type>) {
             const auto entt = underlying_type::emplace(hint, std::forward<Args>(args)...);
+            ENTT_INSTRUMENT(this->counters().publishes += !construction.empty());
             construction.publish(owner_or_assert(), entt);
             return entt;
         } else {
             underlying_type::emplace(hint, std::forward<Args>(args)...);
+            ENTT_INSTRUMENT(this->counters().publishes += !construction.empty());
             construction.publish(owner_or_assert(), hint);
             return this->get(hint);
         }
@@ -247,6 +298,7 @@ public:
     template<typename... Func>
     decltype(auto) patch(const entity_type entt, Func &&...func) {
         underlying_type::patch(entt, std::forward<Func>(func)...);
+        ENTT_INSTRUMENT(this->counters().publishes += !update.empty());
         update.publish(owner_or_assert(), entt);
         return this->get(entt);
     }
@@ -270,6 +322,7 @@ public:
 
         if(auto &reg = owner_or_assert(); !construction.empty()) {
             for(; first != last; ++first) {
+                ENTT_INSTRUMENT(++this->counters().publishes);
                 construction.publish(reg, *first);
             }
         }
@@ -285,11 +338,21 @@ public:
         underlying_type::bind(std::move(value));
     }
 
+    /*! @copydoc basic_sparse_set::fork */
+    [[nodiscard]] std::shared_ptr<typename underlying_type::base_type> fork() const final {
+        if constexpr(std::is_copy_constructible_v<typename underlying_type::value_type>) {
+            return internal::fork_using_allocator(*this);
+        } else {
+            return nullptr;
+        }
+    }
+
 private:
     basic_registry_type *owner;
     sigh_type construction;
     sigh_type destruction;
     sigh_type update;
+    bool batching{};
 };
 
 } // namespace entt
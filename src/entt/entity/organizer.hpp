@@ -5,6 +5,7 @@
 #include <type_traits>
 #include <utility>
 #include <vector>
+#include "../core/trace.hpp"
 #include "../core/type_info.hpp"
 #include "../core/type_traits.hpp"
 #include "../core/utility.hpp"
@@ -297,6 +298,7 @@ public:
         constexpr auto requires_registry = type_list_contains_v<typename resource_type::args, registry_type>;
 
         callback_type *callback = +[](const void *, registry_type &reg) {
+            ENTT_TRACE_SCOPE("organizer", (type_name<std::integral_constant<decltype(Candidate), Candidate>>::value()));
             std::apply(Candidate, to_args(reg, typename resource_type::args{}));
         };
 
@@ -329,6 +331,7 @@ public:
         constexpr auto requires_registry = type_list_contains_v<typename resource_type::args, registry_type>;
 
         callback_type *callback = +[](const void *payload, registry_type &reg) {
+            ENTT_TRACE_SCOPE("organizer", (type_name<std::integral_constant<decltype(Candidate), Candidate>>::value()));
             Type *curr = static_cast<Type *>(const_cast<constness_as_t<void, Type> *>(payload));
             std::apply(Candidate, std::tuple_cat(std::forward_as_tuple(*curr), to_args(reg, typename resource_type::args{})));
         };
@@ -0,0 +1,275 @@
+#ifndef ENTT_ENTITY_PAGE_POOL_HPP
+#define ENTT_ENTITY_PAGE_POOL_HPP
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <new>
+#include <utility>
+#include "../config/config.h"
+#include "../container/dense_map.hpp"
+#include "../core/utility.hpp"
+#include "component.hpp"
+#include "fwd.hpp"
+
+namespace entt {
+
+/*! @brief Statistics of a size class of a page pool. */
+struct page_stats {
+    /*! @brief Size in bytes of the pages of the class. */
+    std::size_t size{};
+    /*! @brief Number of pages obtained from the system and not yet released. */
+    std::size_t allocated{};
+    /*! @brief Number of pages currently handed out. */
+    std::size_t in_use{};
+    /*! @brief Number of requests served with a page that was returned. */
+    std::size_t reused{};
+};
+
+/**
+ * @brief Pool of pages shared by many storage classes.
+ *
+ * Pages are grouped in size classes by their size in bytes. Returned pages
+ * aren't freed but kept aside and handed out to the next request of the same
+ * size, no matter what type of storage it comes from.<br/>
+ * Requests smaller than a given threshold or that need an extended alignment
+ * aren't pooled.
+ *
+ * @warning
+ * A page pool isn't thread safe and must outlive all the containers that use
+ * it.
+ */
+class page_pool {
+    struct node_type {
+        node_type *next;
+    };
+
+    struct bucket_type {
+        node_type *head{};
+        page_stats stats{};
+    };
+
+public:
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /**
+     * @brief Constructs an empty pool.
+     * @param min The size in bytes of the smallest request to pool.
+     */
+    explicit page_pool(const size_type min = 1024u)
+        : buckets{},
+          threshold{min < sizeof(node_type) ? sizeof(node_type) : min} {}
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    page_pool(const page_pool &) = delete;
+
+    /*! @brief Default move constructor, deleted on purpose. */
+    page_pool(page_pool &&) = delete;
+
+    /*! @brief Frees all the pages of the pool. */
+    ~page_pool() {
+        release();
+    }
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This pool.
+     */
+    page_pool &operator=(const page_pool &) = delete;
+
+    /**
+     * @brief Default move assignment operator, deleted on purpose.
+     * @return This pool.
+     */
+    page_pool &operator=(page_pool &&) = delete;
+
+    /**
+     * @brief Allocates a page of the given size.
+     * @param bytes The size in bytes of the page.
+     * @param alignment The alignment of the page.
+     * @return A pointer to the page.
+     */
+    [[nodiscard]] void *allocate(const size_type bytes, const size_type alignment = alignof(std::max_align_t)) {
+        if(alignment > alignof(std::max_align_t)) {
+            return ::operator new(bytes, std::align_val_t{alignment});
+        } else if(bytes < threshold) {
+            return ::operator new(bytes);
+        }
+
+        auto &bucket = buckets[bytes];
+        void *page{};
+
+        if(bucket.head) {
+            page = std::exchange(bucket.head, bucket.head->next);
+            ++bucket.stats.reused;
+        } else {
+            page = ::operator new(bytes);
+            ++bucket.stats.allocated;
+        }
+
+        bucket.stats.size = bytes;
+        ++bucket.stats.in_use;
+
+        return page;
+    }
+
+    /**
+     * @brief Returns a page to the pool.
+     * @param page A page obtained from the pool.
+     * @param bytes The size in bytes of the page.
+     * @param alignment The alignment of the page.
+     */
+    void deallocate(void *page, const size_type bytes, const size_type alignment = alignof(std::max_align_t)) noexcept {
+        if(alignment > alignof(std::max_align_t)) {
+            ::operator delete(page, std::align_val_t{alignment});
+            return;
+        } else if(bytes < threshold) {
+            ::operator delete(page);
+            return;
+        }
+
+        const auto it = buckets.find(bytes);
+        ENTT_ASSERT(it != buckets.end() && it->second.stats.in_use != 0u, "Page not from this pool");
+        auto &bucket = it->second;
+
+        bucket.head = ::new(page) node_type{bucket.head};
+        --bucket.stats.in_use;
+    }
+
+    /*! @brief Frees all the pages that aren't in use. */
+    void release() noexcept {
+        for(auto &&elem: buckets) {
+            auto &bucket = elem.second;
+
+            while(bucket.head) {
+                ::operator delete(std::exchange(bucket.head, bucket.head->next));
+                --bucket.stats.allocated;
+            }
+        }
+    }
+
+    /**
+     * @brief Returns the statistics of a size class.
+     * @param bytes The size in bytes of the pages of the class.
+     * @return The statistics of the given size class.
+     */
+    [[nodiscard]] page_stats stats(const size_type bytes) const {
+        const auto it = buckets.find(bytes);
+        return (it == buckets.end()) ? page_stats{bytes} : it->second.stats;
+    }
+
+    /**
+     * @brief Iterates all size classes and applies the given function object
+     * to their statistics.
+     *
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const page_stats &);
+     * @endcode
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each(Func func) const {
+        for(auto &&elem: buckets) {
+            func(std::as_const(elem.second.stats));
+        }
+    }
+
+private:
+    dense_map<size_type, bucket_type, identity, std::equal_to<size_type>> buckets;
+    size_type threshold;
+};
+
+/**
+ * @brief Allocator that gets its memory from a page pool.
+ *
+ * A registry created with this allocator shares the pool with all its storage
+ * classes. Copies of the allocator, no matter the value type, share the pool
+ * as well.<br/>
+ * Only requests as large as a page of a storage class, that is either a page
+ * of elements or a page of the sparse array, are served by the pool. Any other
+ * request (for example, packed arrays and hash tables that grow over time) goes
+ * to the default allocator, so that one-off size classes don't accumulate.
+ *
+ * @tparam Type Value type.
+ */
+template<typename Type>
+class page_allocator {
+    template<typename>
+    friend class page_allocator;
+
+    [[nodiscard]] static constexpr bool is_page(const std::size_t length) noexcept {
+        return (length == component_traits<Type>::page_size) || (length == ENTT_SPARSE_PAGE);
+    }
+
+public:
+    /*! @brief Value type. */
+    using value_type = Type;
+
+    /**
+     * @brief Constructs an allocator for a given pool.
+     * @param ref A valid reference to a page pool.
+     */
+    page_allocator(page_pool &ref) noexcept
+        : pool{&ref} {}
+
+    /**
+     * @brief Converting constructor.
+     * @tparam Other Value type of the other allocator.
+     * @param other The allocator to copy the pool from.
+     */
+    template<typename Other>
+    page_allocator(const page_allocator<Other> &other) noexcept
+        : pool{other.pool} {}
+
+    /**
+     * @brief Allocates storage for a number of objects.
+     * @param length Number of objects.
+     * @return A pointer to the allocated storage.
+     */
+    [[nodiscard]] Type *allocate(const std::size_t length) {
+        return is_page(length) ? static_cast<Type *>(pool->allocate(length * sizeof(Type), alignof(Type))) : std::allocator<Type>{}.allocate(length);
+    }
+
+    /**
+     * @brief Returns storage to the pool.
+     * @param mem A pointer to storage obtained from the allocator.
+     * @param length Number of objects.
+     */
+    void deallocate(Type *mem, const std::size_t length) noexcept {
+        is_page(length) ? pool->deallocate(mem, length * sizeof(Type), alignof(Type)) : std::allocator<Type>{}.deallocate(mem, length);
+    }
+
+    /**
+     * @brief Compares two allocators.
+     * @tparam Other Value type of the other allocator.
+     * @param other Allocator with which to compare.
+     * @return True if the two allocators share the same pool, false otherwise.
+     */
+    template<typename Other>
+    [[nodiscard]] bool operator==(const page_allocator<Other> &other) const noexcept {
+        return pool == other.pool;
+    }
+
+    /**
+     * @brief Compares two allocators.
+     * @tparam Other Value type of the other allocator.
+     * @param other Allocator with which to compare.
+     * @return False if the two allocators share the same pool, true otherwise.
+     */
+    template<typename Other>
+    [[nodiscard]] bool operator!=(const page_allocator<Other> &other) const noexcept {
+        return !(*this == other);
+    }
+
+private:
+    page_pool *pool;
+};
+
+} // namespace entt
+
+#endif
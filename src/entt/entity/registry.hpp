@@ -253,6 +253,7 @@ class basic_registry {
             return entities;
         } else {
             static_assert(std::is_same_v<Type, std::decay_t<Type>>, "Non-decayed types not allowed");
+            ENTT_ASSERT(!sealed || pools.contains(id), "Pools are frozen");
             auto &cpool = pools[id];
 
             if(!cpool) {
@@ -341,7 +342,8 @@ public:
         : vars{allocator},
           pools{allocator},
           groups{allocator},
-          entities{allocator} {
+          entities{allocator},
+          sealed{} {
         pools.reserve(count);
         rebind();
     }
@@ -354,7 +356,8 @@ public:
         : vars{std::move(other.vars)},
           pools{std::move(other.pools)},
           groups{std::move(other.groups)},
-          entities{std::move(other.entities)} {
+          entities{std::move(other.entities)},
+          sealed{other.sealed} {
         rebind();
     }
 
@@ -368,6 +371,7 @@ public:
         pools = std::move(other.pools);
         groups = std::move(other.groups);
         entities = std::move(other.entities);
+        sealed = other.sealed;
 
         rebind();
 
@@ -385,6 +389,7 @@ public:
         swap(pools, other.pools);
         swap(groups, other.groups);
         swap(entities, other.entities);
+        swap(sealed, other.sealed);
 
         rebind();
         other.rebind();
@@ -398,6 +403,85 @@ public:
         return entities.get_allocator();
     }
 
+    /**
+     * @brief Returns a copy of a registry that is independent from the original.
+     *
+     * Entities and components are copied one pool at a time, trivially copyable
+     * components are copied a page at a time. Pools for types that aren't copy
+     * constructible aren't part of the fork.<br/>
+     * Context variables, groups and listeners aren't copied either.
+     *
+     * @note
+     * Copies are eager. A fork costs as much as copying all the entities and
+     * components of the registry, in both time and memory, no matter how few
+     * of them are touched afterwards.
+     *
+     * @return A copy of the registry.
+     */
+    [[nodiscard]] basic_registry fork() const {
+        basic_registry other{pools.size(), get_allocator()};
+        other.entities = storage_for_type<entity_type>{entities, get_allocator()};
+
+        for(auto &&curr: pools) {
+            if(auto elem = curr.second->fork(); elem) {
+                other.pools.emplace(curr.first, std::move(elem));
+            }
+        }
+
+        other.rebind();
+        return other;
+    }
+
+    /**
+     * @brief Freezes or unfreezes the set of pools of a registry.
+     *
+     * No pools can be created while a registry is frozen. Systems that only
+     * access existing pools can then safely run in parallel, as long as their
+     * accesses don't conflict.<br/>
+     * Attempting to create a pool in a frozen registry results in undefined
+     * behavior. An assertion will abort the execution at runtime in debug mode.
+     *
+     * @param value True to freeze the pools, false otherwise.
+     */
+    void freeze(const bool value = true) noexcept {
+        sealed = value;
+    }
+
+    /**
+     * @brief Checks whether the set of pools of a registry is frozen.
+     * @return True if the pools are frozen, false otherwise.
+     */
+    [[nodiscard]] bool frozen() const noexcept {
+        return sealed;
+    }
+
+#ifdef ENTT_INSTRUMENTATION
+    /**
+     * @brief Visits the instrumentation counters of all storage, entities
+     * included.
+     *
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const std::string_view, const storage_counters &);
+     * @endcode
+     *
+     * The first argument is the name of the type of the storage, as returned
+     * by its type info object.
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void counters(Func func) const {
+        func(entities.type().name(), std::as_const(entities.counters()));
+
+        for(auto &&curr: pools) {
+            func(curr.second->type().name(), std::as_const(curr.second->counters()));
+        }
+    }
+#endif
+
     /**
      * @brief Returns an iterable object to use to _visit_ a registry.
      *
@@ -510,6 +594,37 @@ public:
         entities.insert(std::move(first), std::move(last));
     }
 
+    /**
+     * @brief Creates copies of a prefab for each element in a range.
+     *
+     * Identifiers are generated as if by `create`, then all the components
+     * of the prefab are copied to the new entities one storage at a time.<br/>
+     * Storage lookups happen once per type rather than once per entity and
+     * construction signals are sent in a batch after each storage is filled.
+     * Components that aren't copy constructible are silently ignored.
+     *
+     * @tparam It Type of forward iterator.
+     * @param prefab A valid identifier.
+     * @param first An iterator to the first element of the range to generate.
+     * @param last An iterator past the last element of the range to generate.
+     */
+    template<typename It>
+    void instantiate(const entity_type prefab, It first, It last) {
+        ENTT_ASSERT(valid(prefab), "Invalid identifier");
+        const auto length = entities.free_list();
+        entities.insert(std::move(first), std::move(last));
+
+        // new identifiers are contiguous in the packed array of the entity storage
+        const auto from = entities.each().cbegin().base();
+        const auto to = from + static_cast<typename base_type::iterator::difference_type>(entities.free_list() - length);
+
+        for(size_type pos = pools.size(); pos; --pos) {
+            if(auto &pool = *pools.begin()[pos - 1u].second; pool.contains(prefab)) {
+                pool.push(from, to, pool.value(prefab));
+            }
+        }
+    }
+
     /**
      * @brief Destroys an entity and releases its identifier.
      *
@@ -550,6 +665,10 @@ public:
     /**
      * @brief Destroys all entities in a range and releases their identifiers.
      *
+     * Storage smaller than the range are visited in place of the range itself,
+     * so that each entity is only looked up where it can actually be found.
+     * Empty storage are skipped.
+     *
      * @sa destroy
      *
      * @tparam It Type of input iterator.
@@ -559,10 +678,44 @@ public:
     template<typename It>
     void destroy(It first, It last) {
         const auto from = entities.each().cbegin().base();
-        const auto to = from + entities.pack(first, last);
+        const auto length = entities.pack(first, last);
+        const auto to = from + static_cast<typename base_type::iterator::difference_type>(length);
+        const auto lower = entities.free_list() - length;
+        std::vector<entity_type, typename alloc_traits::template rebind_alloc<entity_type>> buffer{get_allocator()};
 
         for(size_type pos = pools.size(); pos; --pos) {
-            pools.begin()[pos - 1u].second->remove(from, to);
+            auto &pool = *pools.begin()[pos - 1u].second;
+
+            if(pool.size() < length) {
+                // the range is made of the last elements in use of the entity storage
+                for(const auto entt: pool) {
+                    if(entt != tombstone && entities.contains(entt) && !(entities.index(entt) < lower) && (entities.index(entt) < entities.free_list())) {
+                        buffer.push_back(entt);
+                    }
+                }
+            } else if(!pool.empty()) {
+                auto it = from;
+                for(; it != to && pool.contains(*it); ++it) {}
+
+                if(it == to) {
+                    pool.erase(from, to);
+                } else {
+                    buffer.insert(buffer.end(), from, it);
+
+                    for(++it; it != to; ++it) {
+                        if(pool.contains(*it)) {
+                            buffer.push_back(*it);
+                        }
+                    }
+                }
+            }
+
+            if(!buffer.empty()) {
+                using iterator_type = typename base_type::iterator;
+                // a single call per pool lets it erase all elements in one pass
+                pool.erase(iterator_type{buffer, static_cast<typename iterator_type::difference_type>(buffer.size())}, iterator_type{buffer, 0});
+                buffer.clear();
+            }
         }
 
         entities.erase(from, to);
@@ -823,6 +976,31 @@ public:
         }
     }
 
+    /**
+     * @brief Removes tombstones from a registry or only the pools for the
+     * given components, a bounded number of moves at a time.
+     *
+     * The budget applies to each pool separately.
+     *
+     * @tparam Type Types of components for which to clear tombstones.
+     * @param count The maximum number of entities to move per pool.
+     * @return True if the pools have no tombstones left, false otherwise.
+     */
+    template<typename... Type>
+    bool compact_step(const size_type count) {
+        if constexpr(sizeof...(Type) == 0u) {
+            bool done = true;
+
+            for(auto &&curr: pools) {
+                done = curr.second->compact_step(count) && done;
+            }
+
+            return done;
+        } else {
+            return (assure<Type>().compact_step(count) & ...);
+        }
+    }
+
     /**
      * @brief Check if an entity is part of all the given storage.
      * @tparam Type Type of storage to check for.
@@ -1197,6 +1375,7 @@ private:
     pool_container_type pools;
     group_container_type groups;
     storage_for_type<entity_type> entities;
+    bool sealed;
 };
 
 } // namespace entt
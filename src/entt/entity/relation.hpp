@@ -0,0 +1,332 @@
+#ifndef ENTT_ENTITY_RELATION_HPP
+#define ENTT_ENTITY_RELATION_HPP
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "../container/dense_map.hpp"
+#include "../core/iterator.hpp"
+#include "entity.hpp"
+#include "fwd.hpp"
+
+namespace entt {
+
+/**
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
+ */
+
+namespace internal {
+
+template<typename Entity>
+struct relation_hash {
+    [[nodiscard]] std::size_t operator()(const std::pair<Entity, Entity> &value) const noexcept {
+        const auto lhs = static_cast<std::size_t>(to_integral(value.first));
+        const auto rhs = static_cast<std::size_t>(to_integral(value.second));
+        return lhs ^ (rhs + 0x9e3779b9u + (lhs << 6u) + (lhs >> 2u));
+    }
+};
+
+} // namespace internal
+
+/**
+ * Internal details not to be documented.
+ * @endcond
+ */
+
+/**
+ * @brief Many-to-many relationship between the entities of a registry.
+ *
+ * A relation stores pairs of entities, that is a source and a target. Both the
+ * targets of a source and the sources of a target are kept in packed arrays.
+ * Therefore, queries cost as much as the number of pairs they return, in both
+ * directions. Adding and removing a pair are constant time operations.<br/>
+ * Pairs are removed automatically when either of their entities is destroyed.
+ *
+ * The order of the targets of a source and the sources of a target isn't
+ * guaranteed and changes when pairs are removed.
+ *
+ * @warning
+ * Lifetime of a relation must not overcome that of the registry to which it is
+ * connected.
+ *
+ * @tparam Kind Type used to tell relations apart, never instantiated.
+ * @tparam Registry Basic registry type.
+ */
+template<typename Kind, typename Registry>
+class basic_relation {
+    static_assert(!std::is_const_v<Registry>, "Non-const registry type required");
+
+    using alloc_traits = std::allocator_traits<typename Registry::allocator_type>;
+    using key_type = std::pair<typename Registry::entity_type, typename Registry::entity_type>;
+    using position_type = std::pair<std::size_t, std::size_t>;
+    using pair_container_type = dense_map<key_type, position_type, internal::relation_hash<typename Registry::entity_type>, std::equal_to<key_type>, typename alloc_traits::template rebind_alloc<std::pair<const key_type, position_type>>>;
+    using list_type = std::vector<typename Registry::entity_type, typename alloc_traits::template rebind_alloc<typename Registry::entity_type>>;
+    using adjacency_type = dense_map<typename Registry::entity_type, list_type, std::hash<typename Registry::entity_type>, std::equal_to<typename Registry::entity_type>, typename alloc_traits::template rebind_alloc<std::pair<const typename Registry::entity_type, list_type>>>;
+
+    template<bool Outgoing>
+    void unlink(const typename Registry::entity_type entt, const std::size_t pos) {
+        auto &adjacency = Outgoing ? outgoing : incoming;
+        const auto it = adjacency.find(entt);
+        auto &list = it->second;
+
+        if(const auto other = list.back(); pos != (list.size() - 1u)) {
+            list[pos] = other;
+
+            if constexpr(Outgoing) {
+                pairs.find(key_type{entt, other})->second.first = pos;
+            } else {
+                pairs.find(key_type{other, entt})->second.second = pos;
+            }
+        }
+
+        list.pop_back();
+
+        if(list.empty()) {
+            adjacency.erase(it);
+        }
+    }
+
+    void release(Registry &, const typename Registry::entity_type entt) {
+        remove(entt);
+    }
+
+    [[nodiscard]] static iterable_adaptor<const typename Registry::entity_type *> as_iterable(const adjacency_type &adjacency, const typename Registry::entity_type entt) {
+        if(const auto it = adjacency.find(entt); it != adjacency.cend()) {
+            return {it->second.data(), it->second.data() + it->second.size()};
+        }
+
+        return {};
+    }
+
+public:
+    /*! Basic registry type. */
+    using registry_type = Registry;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = typename registry_type::entity_type;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Iterable object returned by the adjacency queries. */
+    using iterable = iterable_adaptor<const entity_type *>;
+
+    /**
+     * @brief Creates an empty relation and connects it to a given registry.
+     * @param source A valid reference to a registry.
+     */
+    basic_relation(registry_type &source)
+        : pairs{source.get_allocator()},
+          outgoing{source.get_allocator()},
+          incoming{source.get_allocator()},
+          reg{&source} {
+        reg->template on_destroy<entity_type>().template connect<&basic_relation::release>(*this);
+    }
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    basic_relation(const basic_relation &) = delete;
+
+    /*! @brief Default move constructor, deleted on purpose. */
+    basic_relation(basic_relation &&) = delete;
+
+    /*! @brief Disconnects the relation from its registry. */
+    ~basic_relation() {
+        reg->template on_destroy<entity_type>().disconnect(this);
+    }
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This relation.
+     */
+    basic_relation &operator=(const basic_relation &) = delete;
+
+    /**
+     * @brief Default move assignment operator, deleted on purpose.
+     * @return This relation.
+     */
+    basic_relation &operator=(basic_relation &&) = delete;
+
+    /**
+     * @brief Adds a pair to the relation, if it isn't already there.
+     * @param source A valid identifier.
+     * @param target A valid identifier.
+     * @return True if the pair was added, false otherwise.
+     */
+    bool emplace(const entity_type source, const entity_type target) {
+        ENTT_ASSERT(reg->valid(source) && reg->valid(target), "Invalid entity");
+
+        if(pairs.contains(key_type{source, target})) {
+            return false;
+        }
+
+        auto &from = outgoing.try_emplace(source, pairs.get_allocator()).first->second;
+        auto &to = incoming.try_emplace(target, pairs.get_allocator()).first->second;
+
+        pairs.emplace(key_type{source, target}, position_type{from.size(), to.size()});
+        from.push_back(target);
+        to.push_back(source);
+
+        return true;
+    }
+
+    /**
+     * @brief Removes a pair from the relation, if it's there.
+     * @param source A valid identifier.
+     * @param target A valid identifier.
+     * @return True if the pair was removed, false otherwise.
+     */
+    bool remove(const entity_type source, const entity_type target) {
+        if(const auto it = pairs.find(key_type{source, target}); it != pairs.end()) {
+            const auto pos = it->second;
+            pairs.erase(it);
+            unlink<true>(source, pos.first);
+            unlink<false>(target, pos.second);
+            return true;
+        }
+
+        return false;
+    }
+
+    /**
+     * @brief Removes all the pairs that contain a given entity, either as a
+     * source or as a target.
+     * @param entt A valid identifier.
+     * @return The number of pairs removed.
+     */
+    size_type remove(const entity_type entt) {
+        size_type count{};
+
+        if(const auto it = outgoing.find(entt); it != outgoing.end()) {
+            const auto list = std::move(it->second);
+            outgoing.erase(it);
+
+            for(const auto other: list) {
+                const auto curr = pairs.find(key_type{entt, other});
+                unlink<false>(other, curr->second.second);
+                pairs.erase(curr);
+            }
+
+            count += list.size();
+        }
+
+        if(const auto it = incoming.find(entt); it != incoming.end()) {
+            const auto list = std::move(it->second);
+            incoming.erase(it);
+
+            for(const auto other: list) {
+                const auto curr = pairs.find(key_type{other, entt});
+                unlink<true>(other, curr->second.first);
+                pairs.erase(curr);
+            }
+
+            count += list.size();
+        }
+
+        return count;
+    }
+
+    /*! @brief Removes all the pairs from the relation. */
+    void clear() {
+        pairs.clear();
+        outgoing.clear();
+        incoming.clear();
+    }
+
+    /**
+     * @brief Checks if a relation contains a pair.
+     * @param source A valid identifier.
+     * @param target A valid identifier.
+     * @return True if the relation contains the pair, false otherwise.
+     */
+    [[nodiscard]] bool contains(const entity_type source, const entity_type target) const {
+        return pairs.contains(key_type{source, target});
+    }
+
+    /**
+     * @brief Returns the number of pairs in a relation.
+     * @return Number of pairs in the relation.
+     */
+    [[nodiscard]] size_type size() const noexcept {
+        return pairs.size();
+    }
+
+    /**
+     * @brief Checks whether a relation is empty.
+     * @return True if the relation is empty, false otherwise.
+     */
+    [[nodiscard]] bool empty() const noexcept {
+        return pairs.empty();
+    }
+
+    /**
+     * @brief Returns the targets of a given source.
+     * @param source A valid identifier.
+     * @return An iterable object to use to _visit_ the targets.
+     */
+    [[nodiscard]] iterable targets(const entity_type source) const {
+        return as_iterable(outgoing, source);
+    }
+
+    /**
+     * @brief Returns the sources of a given target.
+     * @param target A valid identifier.
+     * @return An iterable object to use to _visit_ the sources.
+     */
+    [[nodiscard]] iterable sources(const entity_type target) const {
+        return as_iterable(incoming, target);
+    }
+
+    /**
+     * @brief Iterates the sources of a given target that are also part of a
+     * view and applies the given function object to them.
+     *
+     * The function object is invoked with the source followed by the elements
+     * returned by the view for it, empty types excluded.
+     *
+     * @tparam View Type of view to use to filter the sources.
+     * @tparam Func Type of the function object to invoke.
+     * @param target A valid identifier.
+     * @param view A view to use to filter the sources.
+     * @param func A valid function object.
+     */
+    template<typename View, typename Func>
+    void each(const entity_type target, const View &view, Func func) const {
+        for(const auto entt: sources(target)) {
+            if(view.contains(entt)) {
+                std::apply(func, std::tuple_cat(std::make_tuple(entt), view.get(entt)));
+            }
+        }
+    }
+
+    /**
+     * @brief Iterates all pairs and applies the given function object to them.
+     *
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const entity_type source, const entity_type target);
+     * @endcode
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each(Func func) const {
+        for(auto &&elem: pairs) {
+            func(elem.first.first, elem.first.second);
+        }
+    }
+
+private:
+    pair_container_type pairs;
+    adjacency_type outgoing;
+    adjacency_type incoming;
+    registry_type *reg;
+};
+
+} // namespace entt
+
+#endif
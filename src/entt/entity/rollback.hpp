@@ -0,0 +1,171 @@
+#ifndef ENTT_ENTITY_ROLLBACK_HPP
+#define ENTT_ENTITY_ROLLBACK_HPP
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "../core/fwd.hpp"
+#include "fwd.hpp"
+
+namespace entt {
+
+/**
+ * @brief Ring buffer of registry states to roll back to.
+ *
+ * A rollback object keeps full copies of the entities and components of a
+ * registry for a fixed number of ticks. The state of the registry is saved by
+ * means of `save` and restored in bulk by means of `rollback`, one pool at a
+ * time.<br/>
+ * Each state is a full snapshot rather than a list of changes. Therefore,
+ * saving a state costs as much as copying all entities and components, no
+ * matter how many of them changed since the last save. Elements are mostly
+ * modified through plain references that no signal reports, hence changes
+ * can't be tracked reliably.<br/>
+ * Components are copied as if by `basic_sparse_set::fork` and therefore pools
+ * of non-copyable types aren't saved. They are cleared on restore instead.
+ *
+ * @warning
+ * Groups, observers and other tools that track entities on their own aren't
+ * aware of rollbacks. Only views are guaranteed to reflect the restored state.
+ *
+ * @tparam Registry Basic registry type.
+ */
+template<typename Registry>
+class basic_rollback {
+    static_assert(!std::is_const_v<Registry>, "Non-const registry type required");
+    using base_type = typename Registry::common_type;
+    using alloc_traits = std::allocator_traits<typename Registry::allocator_type>;
+    using pool_type = std::pair<id_type, std::shared_ptr<base_type>>;
+
+    struct frame_type {
+        std::size_t tick{};
+        std::shared_ptr<base_type> entities{};
+        std::vector<pool_type, typename alloc_traits::template rebind_alloc<pool_type>> pools{};
+    };
+
+    using container_type = std::vector<frame_type, typename alloc_traits::template rebind_alloc<frame_type>>;
+
+    [[nodiscard]] const frame_type *frame(const std::size_t tick) const noexcept {
+        const auto &elem = frames[tick % frames.size()];
+        return (elem.entities && elem.tick == tick) ? &elem : nullptr;
+    }
+
+public:
+    /*! Basic registry type. */
+    using registry_type = Registry;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = typename registry_type::entity_type;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /**
+     * @brief Constructs a rollback object that is bound to a given registry.
+     * @param source A valid reference to a registry.
+     * @param count Number of ticks to keep track of.
+     */
+    basic_rollback(registry_type &source, const size_type count = 8u)
+        : reg{&source},
+          frames{count, source.get_allocator()} {
+        ENTT_ASSERT(count != 0u, "Invalid number of ticks");
+    }
+
+    /*! @brief Default move constructor. */
+    basic_rollback(basic_rollback &&) noexcept = default;
+
+    /*! @brief Default move assignment operator. @return This rollback object. */
+    basic_rollback &operator=(basic_rollback &&) noexcept = default;
+
+    /**
+     * @brief Returns the number of ticks a rollback object keeps track of.
+     * @return Number of ticks to keep track of.
+     */
+    [[nodiscard]] size_type capacity() const noexcept {
+        return frames.size();
+    }
+
+    /**
+     * @brief Checks if the state of the registry for a given tick is available.
+     * @param tick A tick to look for.
+     * @return True if it's possible to roll back to the given tick, false
+     * otherwise.
+     */
+    [[nodiscard]] bool contains(const size_type tick) const noexcept {
+        return (frame(tick) != nullptr);
+    }
+
+    /**
+     * @brief Saves the state of the registry for a given tick.
+     *
+     * All entities and components are copied, not only those that changed
+     * since the last save. The state replaces the oldest one if there is no
+     * room left.
+     *
+     * @param tick The tick to which the state belongs.
+     */
+    void save(const size_type tick) {
+        auto &elem = frames[tick % frames.size()];
+
+        elem.tick = tick;
+        elem.entities = reg->template storage<entity_type>().fork();
+        elem.pools.clear();
+
+        for(auto [id, pool]: reg->storage()) {
+            if(auto copy = pool.fork(); copy) {
+                elem.pools.emplace_back(id, std::move(copy));
+            }
+        }
+    }
+
+    /**
+     * @brief Restores the state of the registry for a given tick.
+     *
+     * Pools created after the state was saved and pools of non-copyable types
+     * are cleared as if by `basic_sparse_set::clear`, before the entities are
+     * restored. Therefore, their listeners are notified as usual. No signals
+     * are sent for the other pools. States saved for later ticks are
+     * discarded.
+     *
+     * @param tick A tick for which the state is available.
+     */
+    void rollback(const size_type tick) {
+        const auto *elem = frame(tick);
+        ENTT_ASSERT(elem != nullptr, "Invalid tick");
+
+        for(auto [id, pool]: reg->storage()) {
+            auto it = elem->pools.cbegin();
+            for(const auto last = elem->pools.cend(); it != last && it->first != id; ++it) {}
+
+            if(it != elem->pools.cend()) {
+                pool.restore(*it->second);
+            } else {
+                pool.clear();
+            }
+        }
+
+        reg->template storage<entity_type>().restore(*elem->entities);
+
+        for(auto &&curr: frames) {
+            if(curr.tick > tick) {
+                curr = frame_type{};
+            }
+        }
+    }
+
+    /*! @brief Discards all the states saved so far. */
+    void clear() {
+        for(auto &&curr: frames) {
+            curr = frame_type{};
+        }
+    }
+
+private:
+    registry_type *reg;
+    container_type frames;
+};
+
+} // namespace entt
+
+#endif
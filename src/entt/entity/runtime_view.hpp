@@ -52,7 +52,14 @@ public:
     }
 
     runtime_view_iterator &operator++() {
-        while(++it != (*pools)[0]->end() && !valid()) {}
+        for(++it; it != (*pools)[0]->end() && !valid();) {
+            if(*it == tombstone) {
+                it = (*pools)[0]->skip_tombstones(it);
+            } else {
+                ++it;
+            }
+        }
+
         return *this;
     }
 
@@ -0,0 +1,233 @@
+#ifndef ENTT_ENTITY_SHARDED_REGISTRY_HPP
+#define ENTT_ENTITY_SHARDED_REGISTRY_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "entity.hpp"
+#include "fwd.hpp"
+#include "migration.hpp"
+
+namespace entt {
+
+/**
+ * @brief Fixed set of registries that are updated independently.
+ *
+ * Each shard is a registry on its own and has its own outbox of pending
+ * migrations. Therefore, shards can be updated in parallel without locking, as
+ * long as each thread only accesses its shard and only requests migrations for
+ * its entities.<br/>
+ * Entities are identified across shards by a pair made of the index of the
+ * shard and the identifier within the shard.
+ *
+ * Migrations are deferred until the next call to `flush` that has exclusive
+ * access to all shards.
+ *
+ * @tparam Registry Basic registry type.
+ */
+template<typename Registry>
+class basic_sharded_registry {
+    static_assert(!std::is_const_v<Registry>, "Non-const registry type required");
+    using alloc_traits = std::allocator_traits<typename Registry::allocator_type>;
+    using message_type = std::pair<typename Registry::entity_type, std::size_t>;
+    using outbox_type = std::vector<message_type, typename alloc_traits::template rebind_alloc<message_type>>;
+
+public:
+    /*! Basic registry type. */
+    using registry_type = Registry;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = typename registry_type::entity_type;
+    /*! @brief Allocator type. */
+    using allocator_type = typename registry_type::allocator_type;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Identifier of an entity across shards. */
+    using handle_type = std::pair<size_type, entity_type>;
+
+    /**
+     * @brief Constructs a given number of shards.
+     * @param count Number of shards.
+     * @param allocator The allocator to use.
+     */
+    explicit basic_sharded_registry(const size_type count, const allocator_type &allocator = allocator_type{})
+        : shards{},
+          outbox{} {
+        ENTT_ASSERT(count != 0u, "Invalid number of shards");
+        shards.reserve(count);
+        outbox.reserve(count);
+
+        for(size_type pos{}; pos < count; ++pos) {
+            shards.emplace_back(allocator);
+            outbox.emplace_back(allocator);
+        }
+    }
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    basic_sharded_registry(const basic_sharded_registry &) = delete;
+
+    /*! @brief Default move constructor, deleted on purpose. */
+    basic_sharded_registry(basic_sharded_registry &&) = delete;
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This sharded registry.
+     */
+    basic_sharded_registry &operator=(const basic_sharded_registry &) = delete;
+
+    /**
+     * @brief Default move assignment operator, deleted on purpose.
+     * @return This sharded registry.
+     */
+    basic_sharded_registry &operator=(basic_sharded_registry &&) = delete;
+
+    /**
+     * @brief Returns the number of shards.
+     * @return Number of shards.
+     */
+    [[nodiscard]] size_type size() const noexcept {
+        return shards.size();
+    }
+
+    /**
+     * @brief Returns the registry of a given shard.
+     * @param pos The index of the shard.
+     * @return The registry of the given shard.
+     */
+    [[nodiscard]] registry_type &shard(const size_type pos) noexcept {
+        ENTT_ASSERT(pos < shards.size(), "Invalid shard");
+        return shards[pos];
+    }
+
+    /*! @copydoc shard */
+    [[nodiscard]] const registry_type &shard(const size_type pos) const noexcept {
+        ENTT_ASSERT(pos < shards.size(), "Invalid shard");
+        return shards[pos];
+    }
+
+    /**
+     * @brief Creates a new entity in a given shard.
+     * @param pos The index of the shard.
+     * @return The identifier of the entity across shards.
+     */
+    [[nodiscard]] handle_type create(const size_type pos) {
+        return {pos, shard(pos).create()};
+    }
+
+    /**
+     * @brief Checks if an identifier refers to a valid entity.
+     * @param elem An identifier of an entity across shards.
+     * @return True if the identifier is valid, false otherwise.
+     */
+    [[nodiscard]] bool valid(const handle_type elem) const {
+        return (elem.first < shards.size()) && shards[elem.first].valid(elem.second);
+    }
+
+    /**
+     * @brief Iterates all shards and applies the given function object to them.
+     *
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const size_type, registry_type &);
+     * @endcode
+     *
+     * Shards are visited sequentially. Callers are free to dispatch them to as
+     * many threads as they want instead.
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each(Func func) {
+        for(size_type pos{}; pos < shards.size(); ++pos) {
+            func(pos, shards[pos]);
+        }
+    }
+
+    /**
+     * @brief Requests to move an entity to another shard.
+     *
+     * Only the thread that updates the shard of the entity can request to move
+     * it. An entity must not be moved more than once per flush.
+     *
+     * @param elem An identifier of an entity across shards.
+     * @param to The index of the destination shard.
+     */
+    void move(const handle_type elem, const size_type to) {
+        ENTT_ASSERT(valid(elem), "Invalid entity");
+        ENTT_ASSERT(to < shards.size(), "Invalid shard");
+        outbox[elem.first].emplace_back(elem.second, to);
+    }
+
+    /**
+     * @brief Moves all entities for which it was requested.
+     *
+     * Only elements of the given types are moved. Entities are then destroyed
+     * in the source shard along with their remaining elements.<br/>
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const handle_type from, const handle_type to);
+     * @endcode
+     *
+     * @tparam Type Types of elements to move.
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object to notify of moved entities.
+     */
+    template<typename... Type, typename Func>
+    void flush(Func func) {
+        for(size_type from{}; from < shards.size(); ++from) {
+            auto &queue = outbox[from];
+            std::stable_sort(queue.begin(), queue.end(), [](const auto &lhs, const auto &rhs) { return lhs.second < rhs.second; });
+
+            for(auto first = queue.begin(), last = queue.end(); first != last;) {
+                const auto to = first->second;
+                const auto next = std::find_if(first, last, [to](const auto &elem) { return elem.second != to; });
+
+                if(to != from) {
+                    std::vector<entity_type, typename alloc_traits::template rebind_alloc<entity_type>> entity{shards[from].get_allocator()};
+
+                    for(auto it = first; it != next; ++it) {
+                        if(shards[from].valid(it->first)) {
+                            entity.push_back(it->first);
+                        }
+                    }
+
+                    basic_migration<registry_type> batch{shards[from], shards[to]};
+                    batch.entities(entity.begin(), entity.end());
+                    (batch.template get<Type>(), ...);
+                    batch.destroy();
+
+                    for(const auto entt: entity) {
+                        func(handle_type{from, entt}, handle_type{to, batch.map(entt)});
+                    }
+                }
+
+                first = next;
+            }
+
+            queue.clear();
+        }
+    }
+
+    /**
+     * @brief Moves all entities for which it was requested.
+     * @tparam Type Types of elements to move.
+     */
+    template<typename... Type>
+    void flush() {
+        flush<Type...>([](auto &&...) {});
+    }
+
+private:
+    std::vector<registry_type> shards;
+    std::vector<outbox_type> outbox;
+};
+
+} // namespace entt
+
+#endif
@@ -3,12 +3,15 @@
 
 #include <cstddef>
 #include <iterator>
+#include <limits>
 #include <tuple>
 #include <type_traits>
 #include <utility>
 #include <vector>
 #include "../config/config.h"
 #include "../container/dense_map.hpp"
+#include "../core/trace.hpp"
+#include "../core/type_info.hpp"
 #include "../core/type_traits.hpp"
 #include "entity.hpp"
 #include "fwd.hpp"
@@ -34,6 +37,15 @@ void orphans(Registry &registry) {
     }
 }
 
+template<typename Type>
+struct loader_progress {
+    std::size_t stage{};
+    Type length{};
+    Type count{};
+    Type offset{};
+    bool pending{};
+};
+
 } // namespace internal
 
 /**
@@ -85,6 +97,8 @@ public:
      */
     template<typename Type, typename Archive>
     const basic_snapshot &get(Archive &archive, const id_type id = type_hash<Type>::value()) const {
+        ENTT_TRACE_SCOPE("snapshot", type_name<Type>::value());
+
         if(const auto *storage = reg->template storage<Type>(id); storage) {
             archive(static_cast<typename traits_type::entity_type>(storage->size()));
 
@@ -121,6 +135,7 @@ public:
     template<typename Type, typename Archive, typename It>
     const basic_snapshot &get(Archive &archive, It first, It last, const id_type id = type_hash<Type>::value()) const {
         static_assert(!std::is_same_v<Type, entity_type>, "Entity types not supported");
+        ENTT_TRACE_SCOPE("snapshot", type_name<Type>::value());
 
         if(const auto *storage = reg->template storage<Type>(id); storage && !storage->empty()) {
             archive(static_cast<typename traits_type::entity_type>(std::distance(first, last)));
@@ -159,6 +174,55 @@ class basic_snapshot_loader {
     static_assert(!std::is_const_v<Registry>, "Non-const registry type required");
     using traits_type = typename Registry::traits_type;
 
+    template<typename Type, typename Archive>
+    bool load(Archive &archive, std::size_t &budget, const id_type id) {
+        ENTT_TRACE_SCOPE("snapshot", type_name<Type>::value());
+        auto &storage = reg->template storage<Type>(id);
+
+        if(!progress.pending) {
+            progress.pending = true;
+            progress.offset = {};
+            archive(progress.length);
+
+            if constexpr(std::is_same_v<Type, typename Registry::entity_type>) {
+                storage.reserve(progress.length);
+                archive(progress.count);
+            }
+        }
+
+        if constexpr(std::is_same_v<Type, typename Registry::entity_type>) {
+            for(Type entity = null; budget && (progress.offset != progress.length); --budget, ++progress.offset) {
+                archive(entity);
+                storage.emplace(entity);
+            }
+
+            if(progress.offset == progress.length) {
+                storage.free_list(progress.count);
+            }
+        } else {
+            auto &other = reg->template storage<typename Registry::entity_type>();
+            typename Registry::entity_type entt{null};
+
+            for(; budget && (progress.offset != progress.length); --budget, ++progress.offset) {
+                if(archive(entt); entt != null) {
+                    const auto entity = other.contains(entt) ? entt : other.emplace(entt);
+                    ENTT_ASSERT(entity == entt, "Entity not available for use");
+
+                    if constexpr(Registry::template storage_for_type<Type>::traits_type::page_size == 0u) {
+                        storage.emplace(entity);
+                    } else {
+                        Type elem{};
+                        archive(elem);
+                        storage.emplace(entity, std::move(elem));
+                    }
+                }
+            }
+        }
+
+        progress.pending = (progress.offset != progress.length);
+        return !progress.pending;
+    }
+
 public:
     /*! Basic registry type. */
     using registry_type = Registry;
@@ -170,7 +234,8 @@ public:
      * @param source A valid reference to a registry.
      */
     basic_snapshot_loader(registry_type &source) noexcept
-        : reg{&source} {
+        : progress{},
+          reg{&source} {
         // restoring a snapshot as a whole requires a clean registry
         ENTT_ASSERT(reg->template storage<entity_type>().empty() && (reg->storage().begin() == reg->storage().end()), "Registry must be empty");
     }
@@ -191,46 +256,41 @@ public:
      */
     template<typename Type, typename Archive>
     basic_snapshot_loader &get(Archive &archive, const id_type id = type_hash<Type>::value()) {
-        auto &storage = reg->template storage<Type>(id);
-        typename traits_type::entity_type length{};
-
-        archive(length);
-
-        if constexpr(std::is_same_v<Type, entity_type>) {
-            typename traits_type::entity_type count{};
-
-            storage.reserve(length);
-            archive(count);
-
-            for(entity_type entity = null; length; --length) {
-                archive(entity);
-                storage.emplace(entity);
-            }
-
-            storage.free_list(count);
-        } else {
-            auto &other = reg->template storage<entity_type>();
-            entity_type entt{null};
-
-            while(length--) {
-                if(archive(entt); entt != null) {
-                    const auto entity = other.contains(entt) ? entt : other.emplace(entt);
-                    ENTT_ASSERT(entity == entt, "Entity not available for use");
-
-                    if constexpr(Registry::template storage_for_type<Type>::traits_type::page_size == 0u) {
-                        storage.emplace(entity);
-                    } else {
-                        Type elem{};
-                        archive(elem);
-                        storage.emplace(entity, std::move(elem));
-                    }
-                }
-            }
-        }
-
+        auto budget = (std::numeric_limits<std::size_t>::max)();
+        load<Type>(archive, budget, id);
         return *this;
     }
 
+    /**
+     * @brief Restores at most a given number of elements from a sequence of
+     * types, then suspends the loading process.
+     *
+     * The loader keeps track of where it stopped and resumes from there on the
+     * next call. Types must be the same and in the same order on each call, as
+     * if they were restored one at a time by means of `get`.<br/>
+     * Storage with custom names aren't supported.
+     *
+     * @warning
+     * Loading isn't atomic. Elements are written to the registry as they are
+     * read, so entities restored during a step are visible as soon as the
+     * function returns, possibly without all their components. Systems that
+     * shouldn't see half-loaded entities must not run until loading is done.
+     *
+     * @tparam Type Types of elements to restore.
+     * @tparam Archive Type of input archive.
+     * @param archive A valid reference to an input archive.
+     * @param budget Maximum number of elements to restore.
+     * @return True if all types were restored entirely, false otherwise.
+     */
+    template<typename... Type, typename Archive>
+    bool step(Archive &archive, std::size_t budget) {
+        std::size_t pos{};
+        ((pos++ < progress.stage || (budget != 0u && load<Type>(archive, budget, type_hash<Type>::value()) && ++progress.stage)), ...);
+        const bool done = (progress.stage == sizeof...(Type));
+        progress.stage = done ? 0u : progress.stage;
+        return done;
+    }
+
     /**
      * @brief Destroys those entities that have no components.
      *
@@ -247,6 +307,7 @@ public:
     }
 
 private:
+    internal::loader_progress<typename traits_type::entity_type> progress;
     registry_type *reg;
 };
 
@@ -281,6 +342,57 @@ class basic_continuous_loader {
         }
     }
 
+    template<typename Type, typename Archive>
+    bool load(Archive &archive, std::size_t &budget, const id_type id) {
+        ENTT_TRACE_SCOPE("snapshot", type_name<Type>::value());
+        auto &storage = reg->template storage<Type>(id);
+        typename Registry::entity_type entt{null};
+
+        if(!progress.pending) {
+            progress.pending = true;
+            progress.offset = {};
+            archive(progress.length);
+
+            if constexpr(std::is_same_v<Type, typename Registry::entity_type>) {
+                storage.reserve(progress.length);
+                archive(progress.count);
+            } else {
+                for(auto &&ref: remloc) {
+                    storage.remove(ref.second.second);
+                }
+            }
+        }
+
+        for(; budget && (progress.offset != progress.length); --budget, ++progress.offset) {
+            archive(entt);
+
+            if constexpr(std::is_same_v<Type, typename Registry::entity_type>) {
+                if(progress.offset < progress.count) {
+                    restore(entt);
+                } else if(const auto entity = to_entity(entt); remloc.contains(entity)) {
+                    if(reg->valid(remloc[entity].second)) {
+                        reg->destroy(remloc[entity].second);
+                    }
+
+                    remloc.erase(entity);
+                }
+            } else if(entt != null) {
+                restore(entt);
+
+                if constexpr(Registry::template storage_for_type<Type>::traits_type::page_size == 0u) {
+                    storage.emplace(map(entt));
+                } else {
+                    Type elem{};
+                    archive(elem);
+                    storage.emplace(map(entt), std::move(elem));
+                }
+            }
+        }
+
+        progress.pending = (progress.offset != progress.length);
+        return !progress.pending;
+    }
+
     template<typename Container>
     auto update(int, Container &container) -> decltype(typename Container::mapped_type{}, void()) {
         // map like container
@@ -338,6 +450,7 @@ public:
      */
     basic_continuous_loader(registry_type &source) noexcept
         : remloc{source.get_allocator()},
+          progress{},
           reg{&source} {}
 
     /*! @brief Default move constructor. */
@@ -362,57 +475,41 @@ public:
      */
     template<typename Type, typename Archive>
     basic_continuous_loader &get(Archive &archive, const id_type id = type_hash<Type>::value()) {
-        auto &storage = reg->template storage<Type>(id);
-        typename traits_type::entity_type length{};
-        entity_type entt{null};
-
-        archive(length);
-
-        if constexpr(std::is_same_v<Type, entity_type>) {
-            typename traits_type::entity_type in_use{};
-
-            storage.reserve(length);
-            archive(in_use);
-
-            for(std::size_t pos{}; pos < in_use; ++pos) {
-                archive(entt);
-                restore(entt);
-            }
-
-            for(std::size_t pos = in_use; pos < length; ++pos) {
-                archive(entt);
-
-                if(const auto entity = to_entity(entt); remloc.contains(entity)) {
-                    if(reg->valid(remloc[entity].second)) {
-                        reg->destroy(remloc[entity].second);
-                    }
-
-                    remloc.erase(entity);
-                }
-            }
-        } else {
-            for(auto &&ref: remloc) {
-                storage.remove(ref.second.second);
-            }
-
-            while(length--) {
-                if(archive(entt); entt != null) {
-                    restore(entt);
-
-                    if constexpr(Registry::template storage_for_type<Type>::traits_type::page_size == 0u) {
-                        storage.emplace(map(entt));
-                    } else {
-                        Type elem{};
-                        archive(elem);
-                        storage.emplace(map(entt), std::move(elem));
-                    }
-                }
-            }
-        }
-
+        auto budget = (std::numeric_limits<std::size_t>::max)();
+        load<Type>(archive, budget, id);
         return *this;
     }
 
+    /**
+     * @brief Restores at most a given number of elements from a sequence of
+     * types, then suspends the loading process.
+     *
+     * The loader keeps track of where it stopped and resumes from there on the
+     * next call. Types must be the same and in the same order on each call, as
+     * if they were restored one at a time by means of `get`.<br/>
+     * Storage with custom names aren't supported.
+     *
+     * @warning
+     * Loading isn't atomic. Elements are written to the registry as they are
+     * read, so entities restored during a step are visible as soon as the
+     * function returns, possibly without all their components. Systems that
+     * shouldn't see half-loaded entities must not run until loading is done.
+     *
+     * @tparam Type Types of elements to restore.
+     * @tparam Archive Type of input archive.
+     * @param archive A valid reference to an input archive.
+     * @param budget Maximum number of elements to restore.
+     * @return True if all types were restored entirely, false otherwise.
+     */
+    template<typename... Type, typename Archive>
+    bool step(Archive &archive, std::size_t budget) {
+        std::size_t pos{};
+        ((pos++ < progress.stage || (budget != 0u && load<Type>(archive, budget, type_hash<Type>::value()) && ++progress.stage)), ...);
+        const bool done = (progress.stage == sizeof...(Type));
+        progress.stage = done ? 0u : progress.stage;
+        return done;
+    }
+
     /**
      * @brief Destroys those entities that have no components.
      *
@@ -453,6 +550,7 @@ public:
 
 private:
     dense_map<typename traits_type::entity_type, std::pair<entity_type, entity_type>> remloc;
+    internal::loader_progress<typename traits_type::entity_type> progress;
     registry_type *reg;
 };
 
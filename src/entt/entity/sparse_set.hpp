@@ -1,8 +1,10 @@
 #ifndef ENTT_ENTITY_SPARSE_SET_HPP
 #define ENTT_ENTITY_SPARSE_SET_HPP
 
+#include <algorithm>
 #include <cstddef>
 #include <iterator>
+#include <limits>
 #include <memory>
 #include <type_traits>
 #include <utility>
@@ -11,6 +13,7 @@
 #include "../core/algorithm.hpp"
 #include "../core/any.hpp"
 #include "../core/memory.hpp"
+#include "../core/trace.hpp"
 #include "../core/type_info.hpp"
 #include "entity.hpp"
 #include "fwd.hpp"
@@ -24,6 +27,19 @@ namespace entt {
 
 namespace internal {
 
+[[nodiscard]] constexpr std::size_t highest_bit(std::size_t value) noexcept {
+    std::size_t pos{};
+
+    for(auto shift = static_cast<std::size_t>(std::numeric_limits<std::size_t>::digits / 2); shift != 0u; shift /= 2u) {
+        if((value >> shift) != 0u) {
+            value >>= shift;
+            pos += shift;
+        }
+    }
+
+    return pos;
+}
+
 template<typename Container>
 struct sparse_set_iterator final {
     using value_type = typename Container::value_type;
@@ -136,6 +152,55 @@ template<typename Container>
     return !(lhs < rhs);
 }
 
+template<typename Type>
+[[nodiscard]] std::shared_ptr<Type> fork_using_allocator(const Type &other) {
+    using alloc_traits = typename std::allocator_traits<typename Type::allocator_type>::template rebind_traits<Type>;
+    typename alloc_traits::allocator_type allocator{other.get_allocator()};
+    auto *ptr = to_address(alloc_traits::allocate(allocator, 1u));
+
+    ENTT_TRY {
+        // in-place construction, uses-allocator construction would append the allocator twice
+        ::new(static_cast<void *>(ptr)) Type{other, other.get_allocator()};
+    }
+    ENTT_CATCH {
+        alloc_traits::deallocate(allocator, ptr, 1u);
+        ENTT_THROW;
+    }
+
+    return std::shared_ptr<Type>{ptr, [allocator](Type *elem) mutable { elem->~Type(); alloc_traits::deallocate(allocator, elem, 1u); }, allocator};
+}
+
+#ifdef ENTT_INSTRUMENTATION
+class instrumentation_counter {
+public:
+    instrumentation_counter() noexcept = default;
+
+    instrumentation_counter(const instrumentation_counter &other) noexcept
+        : value{other} {}
+
+    instrumentation_counter &operator=(const instrumentation_counter &other) noexcept {
+        value.store(other, std::memory_order_relaxed);
+        return *this;
+    }
+
+    instrumentation_counter &operator+=(const std::uint64_t count) noexcept {
+        value.fetch_add(count, std::memory_order_relaxed);
+        return *this;
+    }
+
+    instrumentation_counter &operator++() noexcept {
+        return (*this += 1u);
+    }
+
+    [[nodiscard]] operator std::uint64_t() const noexcept {
+        return value.load(std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<std::uint64_t> value{};
+};
+#endif
+
 } // namespace internal
 
 /**
@@ -143,6 +208,30 @@ template<typename Container>
  * @endcond
  */
 
+#ifdef ENTT_INSTRUMENTATION
+/**
+ * @brief Instrumentation counters of a sparse set or storage.
+ *
+ * Counters are relaxed atomics, it's safe to update them from multiple threads
+ * but they don't synchronize anything.<br/>
+ * Assigning a default constructed object resets all counters.
+ */
+struct storage_counters {
+    /*! @brief Number of lookups (contains, index and all functions built on top of them). */
+    internal::instrumentation_counter lookups{};
+    /*! @brief Number of entities assigned to the set. */
+    internal::instrumentation_counter emplaces{};
+    /*! @brief Number of entities erased from the set. */
+    internal::instrumentation_counter erases{};
+    /*! @brief Number of signals published to at least one listener. */
+    internal::instrumentation_counter publishes{};
+    /*! @brief Number of times the set was sorted. */
+    internal::instrumentation_counter sorts{};
+    /*! @brief Number of view iterations driven by the set. */
+    internal::instrumentation_counter iterations{};
+};
+#endif
+
 /**
  * @brief Basic sparse set implementation.
  *
@@ -168,14 +257,24 @@ class basic_sparse_set {
     static_assert(std::is_same_v<typename alloc_traits::value_type, Entity>, "Invalid value type");
     using sparse_container_type = std::vector<typename alloc_traits::pointer, typename alloc_traits::template rebind_alloc<typename alloc_traits::pointer>>;
     using packed_container_type = std::vector<Entity, Allocator>;
+    using live_container_type = std::vector<std::size_t, typename alloc_traits::template rebind_alloc<std::size_t>>;
     using underlying_type = typename entt_traits<Entity>::entity_type;
 
+    static constexpr auto live_bits = static_cast<std::size_t>(std::numeric_limits<std::size_t>::digits);
+
     [[nodiscard]] auto sparse_ptr(const Entity entt) const {
         const auto pos = static_cast<size_type>(traits_type::to_entity(entt));
         const auto page = pos / traits_type::page_size;
         return (page < sparse.size() && sparse[page]) ? (sparse[page] + fast_mod(pos, traits_type::page_size)) : nullptr;
     }
 
+    [[nodiscard]] bool has(const Entity entt) const noexcept {
+        const auto elem = sparse_ptr(entt);
+        constexpr auto cap = traits_type::entity_mask;
+        // testing versions permits to avoid accessing the packed array
+        return elem && (((~cap & traits_type::to_integral(entt)) ^ traits_type::to_integral(*elem)) < cap);
+    }
+
     [[nodiscard]] auto &sparse_ref(const Entity entt) const {
         ENTT_ASSERT(sparse_ptr(entt), "Invalid element");
         const auto pos = static_cast<size_type>(traits_type::to_entity(entt));
@@ -229,6 +328,22 @@ class basic_sparse_set {
         return traits_type::entity_mask * (mode != deletion_policy::swap_only);
     }
 
+    void revive(const std::size_t pos) {
+        if(mode == deletion_policy::in_place) {
+            if(const auto word = pos / live_bits; !(word < live.size())) {
+                live.resize(word + 1u);
+            }
+
+            live[pos / live_bits] |= (std::size_t{1u} << fast_mod(pos, live_bits));
+        }
+    }
+
+    void bury(const std::size_t pos) noexcept {
+        if(const auto word = pos / live_bits; word < live.size()) {
+            live[word] &= ~(std::size_t{1u} << fast_mod(pos, live_bits));
+        }
+    }
+
 private:
     virtual const void *get_at(const std::size_t) const {
         return nullptr;
@@ -270,6 +385,81 @@ protected:
         packed.pop_back();
     }
 
+    /**
+     * @brief Erases entities from a sparse set.
+     *
+     * Small ranges are erased one entity at a time, each one being swapped with
+     * the last element still in use. Otherwise, entities are first marked as
+     * removed, then the holes they leave are filled in a single pass with the
+     * elements at the end of the packed array. The pass starts at the lowest
+     * removed position and only the elements actually moved have their sparse
+     * index fixed.<br/>
+     * In both cases, storage classes find the removed elements past the end of
+     * the packed array once this function returns.
+     *
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     */
+    void swap_and_pop(basic_iterator first, basic_iterator last) {
+        ENTT_ASSERT(mode == deletion_policy::swap_and_pop, "Deletion policy mismatch");
+        const auto count = static_cast<size_type>(last - first);
+        size_type length = packed.size();
+        size_type lowest = length;
+
+        for(auto it = first; it != last; ++it) {
+            // cannot use it.index() because it would break with cross iterators
+            const auto pos = index(*it);
+            lowest = (pos < lowest) ? pos : lowest;
+        }
+
+        if((length - lowest) > (2u * count)) {
+            // the compaction pass would visit more elements than it removes
+            for(; first != last; ++first) {
+                const auto pos = index(*first);
+
+                if(--length != pos) {
+                    swap_or_move(pos, length);
+                    swap_at(pos, length);
+                }
+            }
+        } else {
+            for(; first != last; ++first, --length) {
+                const auto entt = *first;
+                packed[index(entt)] = traits_type::combine(traits_type::to_entity(entt), tombstone);
+            }
+
+            ENTT_TRY {
+                for(size_type pos = lowest, from = packed.size(); pos < length; ++pos) {
+                    if(packed[pos] == tombstone) {
+                        for(--from; packed[from] == tombstone; --from) {}
+                        swap_or_move(pos, from);
+
+                        auto &self = sparse_ref(packed[pos]);
+                        self = traits_type::combine(static_cast<typename traits_type::entity_type>(from), traits_type::to_integral(self));
+                        sparse_ref(packed[from]) = traits_type::combine(static_cast<typename traits_type::entity_type>(pos), traits_type::to_integral(packed[from]));
+                        std::swap(packed[pos], packed[from]);
+                    }
+                }
+            }
+            ENTT_CATCH {
+                // sparse indexes are always up-to-date, versions are restored from there
+                for(auto pos = lowest; pos < packed.size(); ++pos) {
+                    if(auto &elem = packed[pos]; elem == tombstone) {
+                        elem = traits_type::combine(traits_type::to_entity(elem), traits_type::to_integral(sparse_ref(elem)));
+                    }
+                }
+
+                ENTT_THROW;
+            }
+        }
+
+        for(auto pos = length; pos < packed.size(); ++pos) {
+            sparse_ref(packed[pos]) = null;
+        }
+
+        packed.erase(packed.begin() + static_cast<typename packed_container_type::difference_type>(length), packed.end());
+    }
+
     /**
      * @brief Erases an entity from a sparse set.
      * @param it An iterator to the element to pop.
@@ -277,7 +467,9 @@ protected:
     void in_place_pop(const basic_iterator it) {
         ENTT_ASSERT(mode == deletion_policy::in_place, "Deletion policy mismatch");
         const auto entt = traits_type::to_entity(std::exchange(sparse_ref(*it), null));
-        packed[static_cast<size_type>(entt)] = traits_type::combine(std::exchange(head, entt), tombstone);
+        const auto pos = static_cast<size_type>(entt);
+        packed[pos] = traits_type::combine(std::exchange(head, entt), tombstone);
+        bury(pos);
     }
 
 protected:
@@ -289,9 +481,7 @@ protected:
     virtual void pop(basic_iterator first, basic_iterator last) {
         switch(mode) {
         case deletion_policy::swap_and_pop:
-            for(; first != last; ++first) {
-                swap_and_pop(first);
-            }
+            swap_and_pop(first, last);
             break;
         case deletion_policy::in_place:
             for(; first != last; ++first) {
@@ -308,27 +498,43 @@ protected:
 
     /*! @brief Erases all entities of a sparse set. */
     virtual void pop_all() {
-        switch(mode) {
-        case deletion_policy::in_place:
-            if(head != traits_type::to_entity(null)) {
-                for(auto first = begin(); !(first.index() < 0); ++first) {
-                    if(*first != tombstone) {
-                        sparse_ref(*first) = null;
+        size_type slots{};
+
+        for(auto &&page: sparse) {
+            slots += (page != nullptr) * traits_type::page_size;
+        }
+
+        if(packed.size() >= (slots / 2u)) {
+            // sparse pages are reset in bulk when entities cover them densely
+            for(auto &&page: sparse) {
+                if(page) {
+                    std::fill(page, page + traits_type::page_size, null);
+                }
+            }
+        } else {
+            switch(mode) {
+            case deletion_policy::in_place:
+                if(head != traits_type::to_entity(null)) {
+                    for(auto first = begin(); !(first.index() < 0); ++first) {
+                        if(*first != tombstone) {
+                            sparse_ref(*first) = null;
+                        }
                     }
+                    break;
+                }
+                [[fallthrough]];
+            case deletion_policy::swap_only:
+            case deletion_policy::swap_and_pop:
+                for(auto first = begin(); !(first.index() < 0); ++first) {
+                    sparse_ref(*first) = null;
                 }
                 break;
             }
-            [[fallthrough]];
-        case deletion_policy::swap_only:
-        case deletion_policy::swap_and_pop:
-            for(auto first = begin(); !(first.index() < 0); ++first) {
-                sparse_ref(*first) = null;
-            }
-            break;
         }
 
         head = policy_to_head();
         packed.clear();
+        live.clear();
     }
 
     /**
@@ -338,6 +544,7 @@ protected:
      * @return Iterator pointing to the emplaced element.
      */
     virtual basic_iterator try_emplace(const Entity entt, const bool force_back, const void * = nullptr) {
+        ENTT_INSTRUMENT(++stats.emplaces);
         auto &elem = assure_at_least(entt);
         auto pos = size();
 
@@ -346,10 +553,13 @@ protected:
             if(head != traits_type::to_entity(null) && !force_back) {
                 pos = static_cast<size_type>(head);
                 ENTT_ASSERT(elem == null, "Slot not available");
+                revive(pos);
                 elem = traits_type::combine(head, traits_type::to_integral(entt));
                 head = traits_type::to_entity(std::exchange(packed[pos], entt));
                 break;
             }
+
+            revive(pos);
             [[fallthrough]];
         case deletion_policy::swap_and_pop:
             packed.push_back(entt);
@@ -376,6 +586,30 @@ protected:
         return --(end() - pos);
     }
 
+    /**
+     * @brief Assigns a range of entities to a sparse set.
+     *
+     * Entities are always appended, the same opaque value is forwarded to
+     * derived classes for all of them.<br/>
+     * The default implementation assigns one entity at a time by means of
+     * `try_emplace`. Derived classes can override it to work in bulk.
+     *
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param value Optional opaque value, shared by all entities.
+     * @return Iterator pointing to the first element inserted in case of
+     * success, the `end()` iterator otherwise.
+     */
+    virtual basic_iterator try_insert(basic_iterator first, basic_iterator last, const void *value = nullptr) {
+        packed.reserve(packed.size() + static_cast<size_type>(last - first));
+
+        for(auto it = first; it != last; ++it) {
+            try_emplace(*it, true, value);
+        }
+
+        return first == last ? end() : find(*first);
+    }
+
 public:
     /*! @brief Entity traits. */
     using traits_type = entt_traits<Entity>;
@@ -427,6 +661,7 @@ public:
     explicit basic_sparse_set(const type_info &elem, deletion_policy pol = deletion_policy::swap_and_pop, const allocator_type &allocator = {})
         : sparse{allocator},
           packed{allocator},
+          live{allocator},
           info{&elem},
           mode{pol},
           head{policy_to_head()} {}
@@ -438,6 +673,7 @@ public:
     basic_sparse_set(basic_sparse_set &&other) noexcept
         : sparse{std::move(other.sparse)},
           packed{std::move(other.packed)},
+          live{std::move(other.live)},
           info{other.info},
           mode{other.mode},
           head{std::exchange(other.head, policy_to_head())} {}
@@ -450,12 +686,45 @@ public:
     basic_sparse_set(basic_sparse_set &&other, const allocator_type &allocator) noexcept
         : sparse{std::move(other.sparse), allocator},
           packed{std::move(other.packed), allocator},
+          live{std::move(other.live), allocator},
           info{other.info},
           mode{other.mode},
           head{std::exchange(other.head, policy_to_head())} {
         ENTT_ASSERT(alloc_traits::is_always_equal::value || packed.get_allocator() == other.packed.get_allocator(), "Copying a sparse set is not allowed");
     }
 
+    /**
+     * @brief Allocator-extended copy constructor.
+     *
+     * Sparse pages are copied as a whole, no matter how many entities they
+     * contain.
+     *
+     * @param other The instance to copy from.
+     * @param allocator The allocator to use.
+     */
+    basic_sparse_set(const basic_sparse_set &other, const allocator_type &allocator)
+        : sparse{other.sparse.size(), nullptr, allocator},
+          packed{other.packed, allocator},
+          live{other.live, allocator},
+          info{other.info},
+          mode{other.mode},
+          head{other.head} {
+        auto page_allocator{packed.get_allocator()};
+
+        ENTT_TRY {
+            for(size_type pos{}, last = sparse.size(); pos < last; ++pos) {
+                if(const auto page = other.sparse[pos]; page) {
+                    sparse[pos] = alloc_traits::allocate(page_allocator, traits_type::page_size);
+                    std::uninitialized_copy(page, page + traits_type::page_size, sparse[pos]);
+                }
+            }
+        }
+        ENTT_CATCH {
+            release_sparse_pages();
+            ENTT_THROW;
+        }
+    }
+
     /*! @brief Default destructor. */
     virtual ~basic_sparse_set() {
         release_sparse_pages();
@@ -472,6 +741,7 @@ public:
         release_sparse_pages();
         sparse = std::move(other.sparse);
         packed = std::move(other.packed);
+        live = std::move(other.live);
         info = other.info;
         mode = other.mode;
         head = std::exchange(other.head, policy_to_head());
@@ -486,6 +756,7 @@ public:
         using std::swap;
         swap(sparse, other.sparse);
         swap(packed, other.packed);
+        swap(live, other.live);
         swap(info, other.info);
         swap(mode, other.mode);
         swap(head, other.head);
@@ -548,6 +819,8 @@ public:
     /*! @brief Requests the removal of unused capacity. */
     virtual void shrink_to_fit() {
         packed.shrink_to_fit();
+        live.resize((packed.size() + live_bits - 1u) / live_bits);
+        live.shrink_to_fit();
     }
 
     /**
@@ -706,6 +979,35 @@ public:
         return rend(0);
     }
 
+    /**
+     * @brief Skips tombstones while iterating a sparse set.
+     *
+     * Sparse sets that use the in-place deletion policy keep track of the
+     * slots in use. Therefore, runs of tombstones are skipped in bulk rather
+     * than one at a time. Other policies step over them one at a time.
+     *
+     * @param it A valid iterator of the sparse set.
+     * @return An iterator to the first entity that isn't a tombstone, starting
+     * from the given iterator, if any, the `end()` iterator otherwise.
+     */
+    [[nodiscard]] iterator skip_tombstones(const iterator it) const noexcept {
+        auto offset = it.index() + 1;
+
+        while(offset != 0 && packed[static_cast<size_type>(offset - 1)] == tombstone) {
+            const auto pos = static_cast<size_type>(offset - 1);
+
+            if(auto word = pos / live_bits; mode == deletion_policy::in_place && word < live.size()) {
+                auto bits = live[word] & ((size_type{1u} << fast_mod(pos, live_bits)) - 1u);
+                for(; bits == 0u && word != 0u; bits = live[--word]) {}
+                offset = (bits == 0u) ? 0 : static_cast<typename iterator::difference_type>(word * live_bits + internal::highest_bit(bits) + 1u);
+            } else {
+                --offset;
+            }
+        }
+
+        return iterator{packed, offset};
+    }
+
     /**
      * @brief Finds an entity.
      * @param entt A valid identifier.
@@ -722,10 +1024,8 @@ public:
      * @return True if the sparse set contains the entity, false otherwise.
      */
     [[nodiscard]] bool contains(const entity_type entt) const noexcept {
-        const auto elem = sparse_ptr(entt);
-        constexpr auto cap = traits_type::entity_mask;
-        // testing versions permits to avoid accessing the packed array
-        return elem && (((~cap & traits_type::to_integral(entt)) ^ traits_type::to_integral(*elem)) < cap);
+        ENTT_INSTRUMENT(++stats.lookups);
+        return has(entt);
     }
 
     /**
@@ -751,7 +1051,9 @@ public:
      * @return The position of the entity in the sparse set.
      */
     [[nodiscard]] size_type index(const entity_type entt) const noexcept {
-        ENTT_ASSERT(contains(entt), "Set does not contain entity");
+        // assertions don't count as lookups
+        ENTT_ASSERT(has(entt), "Set does not contain entity");
+        ENTT_INSTRUMENT(++stats.lookups);
         return static_cast<size_type>(traits_type::to_entity(sparse_ref(entt)));
     }
 
@@ -831,6 +1133,27 @@ public:
         return first == last ? end() : find(*first);
     }
 
+    /**
+     * @brief Assigns one or more entities to a sparse set, all with the same
+     * opaque element.
+     *
+     * This overload saves a virtual call per entity and lets derived classes
+     * copy the same element in bulk.
+     *
+     * @warning
+     * Attempting to assign an entity that already belongs to the sparse set
+     * results in undefined behavior.
+     *
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param elem Optional opaque element to forward to mixins, if any.
+     * @return Iterator pointing to the first element inserted in case of
+     * success, the `end()` iterator otherwise.
+     */
+    iterator push(const iterator first, const iterator last, const void *elem) {
+        return try_insert(first, last, elem);
+    }
+
     /**
      * @brief Bump the version number of an entity.
      *
@@ -859,6 +1182,7 @@ public:
      * @param entt A valid identifier.
      */
     void erase(const entity_type entt) {
+        ENTT_INSTRUMENT(++stats.erases);
         const auto it = to_iterator(entt);
         pop(it, it + 1u);
     }
@@ -875,6 +1199,7 @@ public:
     template<typename It>
     void erase(It first, It last) {
         if constexpr(std::is_same_v<It, basic_iterator>) {
+            ENTT_INSTRUMENT(stats.erases += static_cast<std::uint64_t>(last - first));
             pop(first, last);
         } else {
             for(; first != last; ++first) {
@@ -929,6 +1254,32 @@ public:
 
     /*! @brief Removes all tombstones from a sparse set. */
     void compact() {
+        compact_step((std::numeric_limits<size_type>::max)());
+    }
+
+    /**
+     * @brief Removes tombstones from a sparse set, a bounded number of moves
+     * at a time.
+     *
+     * Holes are filled with the entities at the end of the packed array. Each
+     * entity moved counts against the given budget, while dropping trailing
+     * tombstones is for free.<br/>
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const entity_type);
+     * @endcode
+     *
+     * The function is invoked once for each entity moved, after the move. This
+     * is the place where to fix any pointer to the moved elements.
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param count The maximum number of entities to move.
+     * @param func A valid function object.
+     * @return True if the sparse set has no tombstones left, false otherwise.
+     */
+    template<typename Func>
+    bool compact_step(size_type count, Func func) {
         if(mode == deletion_policy::in_place) {
             size_type from = packed.size();
             for(; from && packed[from - 1u] == tombstone; --from) {}
@@ -936,19 +1287,40 @@ public:
 
             while(pos != traits_type::to_entity(null)) {
                 if(const auto to = static_cast<size_type>(std::exchange(pos, traits_type::to_entity(packed[pos]))); to < from) {
-                    --from;
-                    swap_or_move(from, to);
-
-                    packed[to] = packed[from];
-                    const auto entity = static_cast<typename traits_type::entity_type>(to);
-                    sparse_ref(packed[to]) = traits_type::combine(entity, traits_type::to_integral(packed[to]));
-
-                    for(; from && packed[from - 1u] == tombstone; --from) {}
+                    if(count == 0u) {
+                        // out of budget, holes are left for the next step
+                        packed[to] = traits_type::combine(std::exchange(head, static_cast<underlying_type>(to)), tombstone);
+                    } else {
+                        --count;
+                        --from;
+                        swap_or_move(from, to);
+
+                        packed[to] = packed[from];
+                        const auto entity = static_cast<typename traits_type::entity_type>(to);
+                        sparse_ref(packed[to]) = traits_type::combine(entity, traits_type::to_integral(packed[to]));
+                        revive(to);
+                        bury(from);
+                        func(packed[to]);
+
+                        for(; from && packed[from - 1u] == tombstone; --from) {}
+                    }
                 }
             }
 
             packed.erase(packed.begin() + from, packed.end());
         }
+
+        return (mode != deletion_policy::in_place) || (head == traits_type::to_entity(null));
+    }
+
+    /**
+     * @brief Removes tombstones from a sparse set, a bounded number of moves
+     * at a time.
+     * @param count The maximum number of entities to move.
+     * @return True if the sparse set has no tombstones left, false otherwise.
+     */
+    bool compact_step(const size_type count) {
+        return compact_step(count, [](auto &&...) {});
     }
 
     /**
@@ -1007,6 +1379,8 @@ public:
     void sort_n(const size_type length, Compare compare, Sort algo = Sort{}, Args &&...args) {
         ENTT_ASSERT((mode != deletion_policy::in_place) || (head == traits_type::to_entity(null)), "Sorting with tombstones not allowed");
         ENTT_ASSERT(!(length > packed.size()), "Length exceeds the number of elements");
+        ENTT_INSTRUMENT(++stats.sorts);
+        ENTT_TRACE_SCOPE("sort", info->name());
 
         algo(packed.rend() - length, packed.rend(), std::move(compare), std::forward<Args>(args)...);
 
@@ -1055,6 +1429,8 @@ public:
      */
     void sort_as(const basic_sparse_set &other) {
         ENTT_ASSERT((mode != deletion_policy::in_place) || (head == traits_type::to_entity(null)), "Sorting with tombstones not allowed");
+        ENTT_INSTRUMENT(++stats.sorts);
+        ENTT_TRACE_SCOPE("sort", info->name());
 
         const auto to = other.end();
         auto from = other.begin();
@@ -1073,6 +1449,8 @@ public:
 
     /*! @brief Clears a sparse set. */
     void clear() {
+        ENTT_INSTRUMENT(stats.erases += packed.size());
+        ENTT_TRACE_SCOPE("clear", info->name());
         pop_all();
         // sanity check to avoid subtle issues due to storage classes
         ENTT_ASSERT((compact(), size()) == 0u, "Non-empty set");
@@ -1091,12 +1469,83 @@ public:
     /*! @brief Forwards variables to derived classes, if any. */
     virtual void bind(any) noexcept {}
 
+    /**
+     * @brief Returns a copy of a sparse set that uses the same allocator.
+     *
+     * Derived classes must override this function, otherwise their copies are
+     * sliced.<br/>
+     * Nothing but elements are copied. As an example, listeners connected to a
+     * storage aren't part of its copy.
+     *
+     * @return A copy of the sparse set, an empty pointer if its elements aren't
+     * copyable.
+     */
+    [[nodiscard]] virtual std::shared_ptr<basic_sparse_set> fork() const {
+        return internal::fork_using_allocator(*this);
+    }
+
+    /**
+     * @brief Replaces the elements of a sparse set with a copy of those of a
+     * sparse set of the same type, usually obtained through `fork`.
+     *
+     * Derived classes that add elements of their own must override this
+     * function.<br/>
+     * Nothing but elements are replaced. As an example, listeners connected to
+     * a storage aren't affected and no signals are sent.
+     *
+     * @warning
+     * Storage classes of non-copyable types can't be restored, as much as they
+     * can't be forked. Attempting to restore them results in undefined
+     * behavior. An assertion will abort the execution at runtime in debug
+     * mode.
+     *
+     * @param other A sparse set of the same type to copy elements from.
+     */
+    virtual void restore(const basic_sparse_set &other) {
+        ENTT_ASSERT(other.type() == type(), "Invalid sparse set");
+        basic_sparse_set elem{other, get_allocator()};
+        swap(elem);
+    }
+
+#ifdef ENTT_INSTRUMENTATION
+    /**
+     * @brief Returns the instrumentation counters of a sparse set.
+     *
+     * Counters are bound to the instance. They are neither moved nor swapped
+     * along with the contents of a sparse set.
+     *
+     * @return The instrumentation counters of the sparse set.
+     */
+    [[nodiscard]] const storage_counters &counters() const noexcept {
+        return stats;
+    }
+
+    /*! @copydoc counters */
+    [[nodiscard]] storage_counters &counters() noexcept {
+        return stats;
+    }
+
+    /**
+     * @brief Records an iteration over a sparse set.
+     *
+     * Views only get read-only access to their storage but still account for
+     * their iterations. This is the only counter they can update.
+     */
+    void count_iteration() const noexcept {
+        ++stats.iterations;
+    }
+#endif
+
 private:
     sparse_container_type sparse;
     packed_container_type packed;
+    live_container_type live;
     const type_info *info;
     deletion_policy mode;
     underlying_type head;
+#ifdef ENTT_INSTRUMENTATION
+    mutable storage_counters stats{};
+#endif
 };
 
 } // namespace entt
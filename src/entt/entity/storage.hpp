@@ -2,6 +2,7 @@
 #define ENTT_ENTITY_STORAGE_HPP
 
 #include <cstddef>
+#include <cstring>
 #include <iterator>
 #include <memory>
 #include <tuple>
@@ -181,6 +182,10 @@ public:
         return ++(*this), orig;
     }
 
+    constexpr extended_storage_iterator &operator+=(const difference_type value) noexcept {
+        return std::get<It>(it) += value, ((std::get<Other>(it) += value), ...), *this;
+    }
+
     [[nodiscard]] constexpr pointer operator->() const noexcept {
         return operator*();
     }
@@ -210,6 +215,90 @@ template<typename... Lhs, typename... Rhs>
     return !(lhs == rhs);
 }
 
+template<typename Set, typename It>
+class stable_storage_iterator final {
+    template<typename, typename>
+    friend class stable_storage_iterator;
+
+    constexpr void skip() noexcept {
+        const auto curr = it.base();
+        it += (set->skip_tombstones(curr) - curr);
+    }
+
+public:
+    using iterator_type = typename It::iterator_type;
+    using difference_type = typename It::difference_type;
+    using value_type = typename It::value_type;
+    using pointer = typename It::pointer;
+    using reference = typename It::reference;
+    using iterator_category = std::input_iterator_tag;
+
+    constexpr stable_storage_iterator()
+        : set{},
+          it{} {}
+
+    constexpr stable_storage_iterator(const Set &ref, It base) noexcept
+        : set{&ref},
+          it{base} {
+        skip();
+    }
+
+    template<typename Other, typename = std::enable_if_t<!std::is_same_v<It, Other> && std::is_constructible_v<It, Other>>>
+    constexpr stable_storage_iterator(const stable_storage_iterator<Set, Other> &other) noexcept
+        : set{other.set},
+          it{other.it} {}
+
+    constexpr stable_storage_iterator &operator++() noexcept {
+        return ++it, skip(), *this;
+    }
+
+    constexpr stable_storage_iterator operator++(int) noexcept {
+        stable_storage_iterator orig = *this;
+        return ++(*this), orig;
+    }
+
+    [[nodiscard]] constexpr pointer operator->() const noexcept {
+        return it.operator->();
+    }
+
+    [[nodiscard]] constexpr reference operator*() const noexcept {
+        return *it;
+    }
+
+    [[nodiscard]] constexpr iterator_type base() const noexcept {
+        return it.base();
+    }
+
+    template<typename Type, typename Lhs, typename Rhs>
+    friend constexpr bool operator==(const stable_storage_iterator<Type, Lhs> &, const stable_storage_iterator<Type, Rhs> &) noexcept;
+
+private:
+    const Set *set;
+    It it;
+};
+
+template<typename Type, typename Lhs, typename Rhs>
+[[nodiscard]] constexpr bool operator==(const stable_storage_iterator<Type, Lhs> &lhs, const stable_storage_iterator<Type, Rhs> &rhs) noexcept {
+    return lhs.it == rhs.it;
+}
+
+template<typename Type, typename Lhs, typename Rhs>
+[[nodiscard]] constexpr bool operator!=(const stable_storage_iterator<Type, Lhs> &lhs, const stable_storage_iterator<Type, Rhs> &rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+template<bool Stable, typename Set, typename It>
+using storage_each_iterator = std::conditional_t<Stable, stable_storage_iterator<Set, It>, It>;
+
+template<bool Stable, typename Set, typename It>
+[[nodiscard]] constexpr storage_each_iterator<Stable, Set, It> make_storage_each_iterator(const Set &set, It it) noexcept {
+    if constexpr(Stable) {
+        return {set, it};
+    } else {
+        return it;
+    }
+}
+
 } // namespace internal
 
 /**
@@ -284,6 +373,36 @@ class basic_storage: public basic_sparse_set<Entity, typename std::allocator_tra
         return it;
     }
 
+    template<typename... Args>
+    auto insert_elements(const underlying_iterator first, const underlying_iterator last, const Args &...args) {
+        const auto from = base_type::size();
+        base_type::reserve(from + static_cast<size_type>(last - first));
+
+        for(auto curr = first; curr != last; ++curr) {
+            base_type::try_emplace(*curr, true);
+        }
+
+        const auto it = (first == last) ? base_type::end() : base_type::find(*first);
+        auto pos = from;
+
+        ENTT_TRY {
+            if(const auto to = base_type::size(); from != to) {
+                // elements are appended, pages are allocated once for the whole range
+                assure_at_least(to - 1u);
+
+                for(allocator_type allocator{get_allocator()}; pos < to; ++pos) {
+                    entt::uninitialized_construct_using_allocator(std::addressof(element_at(pos)), allocator, args...);
+                }
+            }
+        }
+        ENTT_CATCH {
+            base_type::pop(base_type::begin(), base_type::begin() + static_cast<typename underlying_iterator::difference_type>(base_type::size() - pos));
+            ENTT_THROW;
+        }
+
+        return it;
+    }
+
     void shrink_to_size(const std::size_t sz) {
         const auto from = (sz + traits_type::page_size - 1u) / traits_type::page_size;
         allocator_type allocator{get_allocator()};
@@ -338,36 +457,44 @@ protected:
      * @param last An iterator past the last element of the range of entities.
      */
     void pop(underlying_iterator first, underlying_iterator last) override {
-        for(allocator_type allocator{get_allocator()}; first != last; ++first) {
-            // cannot use first.index() because it would break with cross iterators
-            auto &elem = element_at(base_type::index(*first));
+        allocator_type allocator{get_allocator()};
 
-            if constexpr(traits_type::in_place_delete) {
+        if constexpr(traits_type::in_place_delete) {
+            for(; first != last; ++first) {
+                // cannot use first.index() because it would break with cross iterators
+                auto &elem = element_at(base_type::index(*first));
                 base_type::in_place_pop(first);
                 alloc_traits::destroy(allocator, std::addressof(elem));
-            } else {
-                auto &other = element_at(base_type::size() - 1u);
-                // destroying on exit allows reentrant destructors
-                [[maybe_unused]] auto unused = std::exchange(elem, std::move(other));
-                alloc_traits::destroy(allocator, std::addressof(other));
-                base_type::swap_and_pop(first);
+            }
+        } else {
+            const auto length = base_type::size();
+            // removed elements are moved past the end, destroying them on exit allows reentrant destructors
+            base_type::swap_and_pop(first, last);
+
+            for(auto pos = base_type::size(); pos < length; ++pos) {
+                alloc_traits::destroy(allocator, std::addressof(element_at(pos)));
             }
         }
     }
 
     /*! @brief Erases all entities of a storage. */
     void pop_all() override {
-        allocator_type allocator{get_allocator()};
+        if constexpr(std::is_trivially_destructible_v<value_type>) {
+            // nothing to destroy, elements aren't visited at all
+            base_type::pop_all();
+        } else {
+            allocator_type allocator{get_allocator()};
 
-        for(auto first = base_type::begin(); !(first.index() < 0); ++first) {
-            if constexpr(traits_type::in_place_delete) {
-                if(*first != tombstone) {
-                    base_type::in_place_pop(first);
+            for(auto first = base_type::begin(); !(first.index() < 0); ++first) {
+                if constexpr(traits_type::in_place_delete) {
+                    if(*first != tombstone) {
+                        base_type::in_place_pop(first);
+                        alloc_traits::destroy(allocator, std::addressof(element_at(static_cast<size_type>(first.index()))));
+                    }
+                } else {
+                    base_type::swap_and_pop(first);
                     alloc_traits::destroy(allocator, std::addressof(element_at(static_cast<size_type>(first.index()))));
                 }
-            } else {
-                base_type::swap_and_pop(first);
-                alloc_traits::destroy(allocator, std::addressof(element_at(static_cast<size_type>(first.index()))));
             }
         }
     }
@@ -395,6 +522,30 @@ protected:
         }
     }
 
+    /**
+     * @brief Assigns a range of entities to a storage.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param value Optional opaque value, shared by all entities.
+     * @return Iterator pointing to the first element inserted in case of
+     * success, the `end()` iterator otherwise.
+     */
+    underlying_iterator try_insert([[maybe_unused]] const underlying_iterator first, [[maybe_unused]] const underlying_iterator last, const void *value) override {
+        if(value) {
+            if constexpr(std::is_copy_constructible_v<value_type>) {
+                return insert_elements(first, last, *static_cast<const value_type *>(value));
+            } else {
+                return base_type::end();
+            }
+        } else {
+            if constexpr(std::is_default_constructible_v<value_type>) {
+                return insert_elements(first, last);
+            } else {
+                return base_type::end();
+            }
+        }
+    }
+
 public:
     /*! @brief Base type. */
     using base_type = underlying_type;
@@ -421,9 +572,9 @@ public:
     /*! @brief Constant reverse iterator type. */
     using const_reverse_iterator = std::reverse_iterator<const_iterator>;
     /*! @brief Extended iterable storage proxy. */
-    using iterable = iterable_adaptor<internal::extended_storage_iterator<typename base_type::iterator, iterator>>;
+    using iterable = iterable_adaptor<internal::storage_each_iterator<traits_type::in_place_delete, base_type, internal::extended_storage_iterator<typename base_type::iterator, iterator>>>;
     /*! @brief Constant extended iterable storage proxy. */
-    using const_iterable = iterable_adaptor<internal::extended_storage_iterator<typename base_type::const_iterator, const_iterator>>;
+    using const_iterable = iterable_adaptor<internal::storage_each_iterator<traits_type::in_place_delete, base_type, internal::extended_storage_iterator<typename base_type::const_iterator, const_iterator>>>;
     /*! @brief Extended reverse iterable storage proxy. */
     using reverse_iterable = iterable_adaptor<internal::extended_storage_iterator<typename base_type::reverse_iterator, reverse_iterator>>;
     /*! @brief Constant extended reverse iterable storage proxy. */
@@ -460,11 +611,82 @@ public:
         ENTT_ASSERT(alloc_traits::is_always_equal::value || payload.get_allocator() == other.payload.get_allocator(), "Copying a storage is not allowed");
     }
 
+    /**
+     * @brief Allocator-extended copy constructor.
+     *
+     * Trivially copyable elements are copied a page at a time.
+     *
+     * @param other The instance to copy from.
+     * @param allocator The allocator to use.
+     */
+    basic_storage(const basic_storage &other, const allocator_type &allocator)
+        : base_type{other, allocator},
+          payload{allocator} {
+        static_assert(std::is_copy_constructible_v<value_type>, "Non-copyable type");
+        const auto length = base_type::size();
+        allocator_type elem_allocator{get_allocator()};
+        size_type pos{};
+
+        ENTT_TRY {
+            if(length) {
+                assure_at_least(length - 1u);
+            }
+
+            if constexpr(std::is_trivially_copyable_v<value_type>) {
+                for(const auto last = payload.size(); pos < last; ++pos) {
+                    std::memcpy(static_cast<void *>(to_address(payload[pos])), to_address(other.payload[pos]), traits_type::page_size * sizeof(value_type));
+                }
+            } else {
+                for(; pos < length; ++pos) {
+                    if(!traits_type::in_place_delete || base_type::data()[pos] != tombstone) {
+                        entt::uninitialized_construct_using_allocator(std::addressof(element_at(pos)), elem_allocator, other.element_at(pos));
+                    }
+                }
+            }
+        }
+        ENTT_CATCH {
+            if constexpr(!std::is_trivially_copyable_v<value_type>) {
+                for(size_type idx{}; idx < pos; ++idx) {
+                    if(!traits_type::in_place_delete || base_type::data()[idx] != tombstone) {
+                        alloc_traits::destroy(elem_allocator, std::addressof(element_at(idx)));
+                    }
+                }
+            }
+
+            for(auto &&page: payload) {
+                alloc_traits::deallocate(elem_allocator, page, traits_type::page_size);
+            }
+
+            ENTT_THROW;
+        }
+    }
+
     /*! @brief Default destructor. */
     ~basic_storage() override {
         shrink_to_size(0u);
     }
 
+    /*! @copydoc basic_sparse_set::fork */
+    [[nodiscard]] std::shared_ptr<base_type> fork() const override {
+        if constexpr(std::is_copy_constructible_v<value_type>) {
+            return internal::fork_using_allocator(*this);
+        } else {
+            return nullptr;
+        }
+    }
+
+    /*! @copydoc basic_sparse_set::restore */
+    void restore(const base_type &other) override {
+        ENTT_ASSERT(other.type() == base_type::type(), "Invalid storage");
+
+        if constexpr(std::is_copy_constructible_v<value_type>) {
+            basic_storage elem{static_cast<const basic_storage &>(other), get_allocator()};
+            swap(elem);
+        } else {
+            ENTT_ASSERT(false, "Non-copyable type");
+        }
+    }
+
     /**
      * @brief Move assignment operator.
      * @param other The instance to move from.
@@ -743,16 +965,17 @@ public:
      *
      * The iterable object returns a tuple that contains the current entity and
      * a reference to its component.
+     * Tombstones are skipped in bulk for types that are deleted in place.
      *
      * @return An iterable object to use to _visit_ the storage.
      */
     [[nodiscard]] iterable each() noexcept {
-        return {internal::extended_storage_iterator{base_type::begin(), begin()}, internal::extended_storage_iterator{base_type::end(), end()}};
+        return {internal::make_storage_each_iterator<traits_type::in_place_delete, base_type>(*this, internal::extended_storage_iterator{base_type::begin(), begin()}), internal::make_storage_each_iterator<traits_type::in_place_delete, base_type>(*this, internal::extended_storage_iterator{base_type::end(), end()})};
     }
 
     /*! @copydoc each */
     [[nodiscard]] const_iterable each() const noexcept {
-        return {internal::extended_storage_iterator{base_type::cbegin(), cbegin()}, internal::extended_storage_iterator{base_type::cend(), cend()}};
+        return {internal::make_storage_each_iterator<traits_type::in_place_delete, base_type>(*this, internal::extended_storage_iterator{base_type::cbegin(), cbegin()}), internal::make_storage_each_iterator<traits_type::in_place_delete, base_type>(*this, internal::extended_storage_iterator{base_type::cend(), cend()})};
     }
 
     /**
@@ -796,9 +1019,9 @@ public:
     /*! @brief Allocator type. */
     using allocator_type = Allocator;
     /*! @brief Extended iterable storage proxy. */
-    using iterable = iterable_adaptor<internal::extended_storage_iterator<typename base_type::iterator>>;
+    using iterable = iterable_adaptor<internal::storage_each_iterator<traits_type::in_place_delete, base_type, internal::extended_storage_iterator<typename base_type::iterator>>>;
     /*! @brief Constant extended iterable storage proxy. */
-    using const_iterable = iterable_adaptor<internal::extended_storage_iterator<typename base_type::const_iterator>>;
+    using const_iterable = iterable_adaptor<internal::storage_each_iterator<traits_type::in_place_delete, base_type, internal::extended_storage_iterator<typename base_type::const_iterator>>>;
     /*! @brief Extended reverse iterable storage proxy. */
     using reverse_iterable = iterable_adaptor<internal::extended_storage_iterator<typename base_type::reverse_iterator>>;
     /*! @brief Constant extended reverse iterable storage proxy. */
@@ -829,6 +1052,14 @@ public:
     basic_storage(basic_storage &&other, const allocator_type &allocator) noexcept
         : base_type{std::move(other), allocator} {}
 
+    /**
+     * @brief Allocator-extended copy constructor.
+     * @param other The instance to copy from.
+     * @param allocator The allocator to use.
+     */
+    basic_storage(const basic_storage &other, const allocator_type &allocator)
+        : base_type{other, allocator} {}
+
     /**
      * @brief Move assignment operator.
      * @param other The instance to move from.
@@ -836,6 +1067,15 @@ public:
      */
     basic_storage &operator=(basic_storage &&other) noexcept = default;
 
+    /*! @copydoc basic_sparse_set::fork */
+    [[nodiscard]] std::shared_ptr<base_type> fork() const override {
+        if constexpr(std::is_copy_constructible_v<value_type>) {
+            return internal::fork_using_allocator(*this);
+        } else {
+            return nullptr;
+        }
+    }
+
     /**
      * @brief Returns the associated allocator.
      * @return The associated allocator.
@@ -922,16 +1162,17 @@ public:
      * @brief Returns an iterable object to use to _visit_ a storage.
      *
      * The iterable object returns a tuple that contains the current entity.
+     * Tombstones are skipped in bulk for types that are deleted in place.
      *
      * @return An iterable object to use to _visit_ the storage.
      */
     [[nodiscard]] iterable each() noexcept {
-        return {internal::extended_storage_iterator{base_type::begin()}, internal::extended_storage_iterator{base_type::end()}};
+        return {internal::make_storage_each_iterator<traits_type::in_place_delete, base_type>(*this, internal::extended_storage_iterator{base_type::begin()}), internal::make_storage_each_iterator<traits_type::in_place_delete, base_type>(*this, internal::extended_storage_iterator{base_type::end()})};
     }
 
     /*! @copydoc each */
     [[nodiscard]] const_iterable each() const noexcept {
-        return {internal::extended_storage_iterator{base_type::cbegin()}, internal::extended_storage_iterator{base_type::cend()}};
+        return {internal::make_storage_each_iterator<traits_type::in_place_delete, base_type>(*this, internal::extended_storage_iterator{base_type::cbegin()}), internal::make_storage_each_iterator<traits_type::in_place_delete, base_type>(*this, internal::extended_storage_iterator{base_type::cend()})};
     }
 
     /**
@@ -979,6 +1220,20 @@ protected:
         return base_type::find(emplace(hint));
     }
 
+    /**
+     * @brief Assigns a range of entities to a storage.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @return Iterator pointing to the first element inserted, if any.
+     */
+    underlying_iterator try_insert(const underlying_iterator first, const underlying_iterator last, const void *) override {
+        for(auto it = first; it != last; ++it) {
+            emplace(*it);
+        }
+
+        return first == last ? base_type::end() : base_type::find(*first);
+    }
+
 public:
     /*! @brief Base type. */
     using base_type = basic_sparse_set<Entity, Allocator>;
@@ -1026,6 +1281,14 @@ public:
     basic_storage(basic_storage &&other, const allocator_type &allocator) noexcept
         : base_type{std::move(other), allocator} {}
 
+    /**
+     * @brief Allocator-extended copy constructor.
+     * @param other The instance to copy from.
+     * @param allocator The allocator to use.
+     */
+    basic_storage(const basic_storage &other, const allocator_type &allocator)
+        : base_type{other, allocator} {}
+
     /**
      * @brief Move assignment operator.
      * @param other The instance to move from.
@@ -1036,6 +1299,11 @@ public:
         return *this;
     }
 
+    /*! @copydoc basic_sparse_set::fork */
+    [[nodiscard]] std::shared_ptr<base_type> fork() const override {
+        return internal::fork_using_allocator(*this);
+    }
+
     /**
      * @brief Returns the object assigned to an entity, that is `void`.
      *
@@ -63,6 +63,16 @@ class view_iterator final {
         return ((Get != 0u) || (entt != tombstone)) && (all_of(pools, entt)) && none_of(filter, entt);
     }
 
+    void seek() noexcept {
+        while(it != last && !valid(*it)) {
+            if(*it == tombstone) {
+                it = leading->skip_tombstones(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
 public:
     using value_type = typename iterator_type::value_type;
     using pointer = typename iterator_type::pointer;
@@ -73,21 +83,22 @@ public:
     constexpr view_iterator() noexcept
         : it{},
           last{},
+          leading{},
           pools{},
           filter{} {}
 
-    view_iterator(iterator_type curr, iterator_type to, std::array<const Type *, Get> value, std::array<const Type *, Exclude> excl) noexcept
+    view_iterator(iterator_type curr, iterator_type to, const Type *from, std::array<const Type *, Get> value, std::array<const Type *, Exclude> excl) noexcept
         : it{curr},
           last{to},
+          leading{from},
           pools{value},
           filter{excl} {
-        while(it != last && !valid(*it)) {
-            ++it;
-        }
+        seek();
     }
 
     view_iterator &operator++() noexcept {
-        while(++it != last && !valid(*it)) {}
+        ++it;
+        seek();
         return *this;
     }
 
@@ -110,6 +121,7 @@ public:
 private:
     iterator_type it;
     iterator_type last;
+    const Type *leading;
     std::array<const Type *, Get> pools;
     std::array<const Type *, Exclude> filter;
 };
@@ -266,6 +278,7 @@ class basic_view<get_t<Get...>, exclude_t<Exclude...>> {
 
     template<typename Func, std::size_t... Index>
     void pick_and_each(Func &func, std::index_sequence<Index...> seq) const {
+        ENTT_INSTRUMENT(view->count_iteration());
         ((std::get<Index>(pools) == view ? each<Index>(func, seq) : void()), ...);
     }
 
@@ -404,7 +417,8 @@ public:
      * @return An iterator to the first entity of the view.
      */
     [[nodiscard]] iterator begin() const noexcept {
-        return view ? iterator{view->begin(0), view->end(0), opaque_check_set(), filter} : iterator{};
+        ENTT_INSTRUMENT(view ? view->count_iteration() : void());
+        return view ? iterator{view->begin(0), view->end(0), view, opaque_check_set(), filter} : iterator{};
     }
 
     /**
@@ -412,7 +426,7 @@ public:
      * @return An iterator to the entity following the last entity of the view.
      */
     [[nodiscard]] iterator end() const noexcept {
-        return view ? iterator{view->end(0), view->end(0), opaque_check_set(), filter} : iterator{};
+        return view ? iterator{view->end(0), view->end(0), view, opaque_check_set(), filter} : iterator{};
     }
 
     /**
@@ -448,7 +462,7 @@ public:
      * iterator otherwise.
      */
     [[nodiscard]] iterator find(const entity_type entt) const noexcept {
-        return contains(entt) ? iterator{view->find(entt), view->end(), opaque_check_set(), filter} : end();
+        return contains(entt) ? iterator{view->find(entt), view->end(), view, opaque_check_set(), filter} : end();
     }
 
     /**
@@ -685,6 +699,7 @@ public:
      * @return An iterator to the first entity of the view.
      */
     [[nodiscard]] iterator begin() const noexcept {
+        ENTT_INSTRUMENT(handle() ? handle()->count_iteration() : void());
         return handle() ? handle()->begin() : iterator{};
     }
 
@@ -704,6 +719,7 @@ public:
      * @return An iterator to the first entity of the reversed view.
      */
     [[nodiscard]] reverse_iterator rbegin() const noexcept {
+        ENTT_INSTRUMENT(handle() ? handle()->count_iteration() : void());
         return handle() ? handle()->rbegin() : reverse_iterator{};
     }
 
@@ -825,6 +841,8 @@ public:
     template<typename Func>
     void each(Func func) const {
         if(auto *view = storage(); view) {
+            ENTT_INSTRUMENT(view->count_iteration());
+
             if constexpr(is_applicable_v<Func, decltype(*view->each().begin())>) {
                 for(const auto pack: view->each()) {
                     std::apply(func, pack);
@@ -851,6 +869,7 @@ public:
      * @return An iterable object to use to _visit_ the view.
      */
     [[nodiscard]] iterable each() const noexcept {
+        ENTT_INSTRUMENT(storage() ? storage()->count_iteration() : void());
         return storage() ? storage()->each() : iterable{};
     }
 
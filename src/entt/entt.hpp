@@ -15,20 +15,31 @@
 #include "core/iterator.hpp"
 #include "core/memory.hpp"
 #include "core/monostate.hpp"
+#include "core/trace.hpp"
 #include "core/tuple.hpp"
 #include "core/type_info.hpp"
 #include "core/type_traits.hpp"
 #include "core/utility.hpp"
+#include "entity/access_tracker.hpp"
 #include "entity/component.hpp"
+#include "entity/diff.hpp"
+#include "entity/double_buffer.hpp"
 #include "entity/entity.hpp"
 #include "entity/group.hpp"
 #include "entity/handle.hpp"
 #include "entity/helper.hpp"
+#include "entity/journal.hpp"
+#include "entity/migration.hpp"
+#include "entity/mirror.hpp"
 #include "entity/mixin.hpp"
 #include "entity/observer.hpp"
 #include "entity/organizer.hpp"
+#include "entity/page_pool.hpp"
 #include "entity/registry.hpp"
+#include "entity/relation.hpp"
+#include "entity/rollback.hpp"
 #include "entity/runtime_view.hpp"
+#include "entity/sharded_registry.hpp"
 #include "entity/snapshot.hpp"
 #include "entity/sparse_set.hpp"
 #include "entity/storage.hpp"
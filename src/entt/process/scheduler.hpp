@@ -7,6 +7,8 @@
 #include <type_traits>
 #include <utility>
 #include <vector>
+#include "../core/trace.hpp"
+#include "../core/type_info.hpp"
 #include "fwd.hpp"
 #include "process.hpp"
 
@@ -76,6 +78,7 @@ class basic_scheduler {
 
     template<typename Proc>
     [[nodiscard]] static bool update(basic_scheduler &owner, std::size_t pos, const Delta delta, void *data) {
+        ENTT_TRACE_SCOPE("scheduler", type_name<Proc>::value());
         auto *process = static_cast<Proc *>(owner.handlers[pos].instance.get());
         process->tick(delta, data);
 
@@ -10,6 +10,7 @@
 #include "../container/dense_map.hpp"
 #include "../core/compressed_pair.hpp"
 #include "../core/fwd.hpp"
+#include "../core/trace.hpp"
 #include "../core/type_info.hpp"
 #include "../core/utility.hpp"
 #include "fwd.hpp"
@@ -48,6 +49,7 @@ public:
           events{allocator} {}
 
     void publish() override {
+        ENTT_TRACE_SCOPE("dispatcher", entt::type_name<Type>::value());
         const auto length = events.size();
 
         for(std::size_t pos{}; pos < length; ++pos) {
@@ -1,11 +1,13 @@
-#include <chrono>
+#include <cstddef>
 #include <cstdint>
-#include <iostream>
+#include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 #include <gtest/gtest.h>
 #include <entt/entity/registry.hpp>
 #include <entt/entity/runtime_view.hpp>
+#include "harness.hpp"
 
 struct position {
     std::uint64_t x;
@@ -23,31 +25,11 @@ struct comp {
     int x;
 };
 
-struct timer final {
-    timer()
-        : start{std::chrono::system_clock::now()} {}
-
-    void elapsed() {
-        auto now = std::chrono::system_clock::now();
-        std::cout << std::chrono::duration<double>(now - start).count() << " seconds" << std::endl;
-    }
-
-private:
-    std::chrono::time_point<std::chrono::system_clock> start;
-};
-
-template<typename Func, typename... Args>
-void generic_with(Func func) {
-    timer timer;
-    func();
-    timer.elapsed();
-}
-
 template<typename Iterable, typename Func>
-void iterate_with(Iterable &&iterable, Func func) {
-    timer timer;
-    std::forward<Iterable>(iterable).each(func);
-    timer.elapsed();
+void iterate_with(const std::size_t items, Iterable &&iterable, Func func) {
+    test::benchmark(items, [&](auto &&measure) {
+        measure([&]() { iterable.each(func); });
+    });
 }
 
 template<typename Func>
@@ -91,361 +73,403 @@ void pathological_with(Func func) {
         }
     }
 
-    timer timer;
-    view.each([](auto &...comp) { ((comp.x = {}), ...); });
-    timer.elapsed();
+    iterate_with(registry.storage<entt::entity>().free_list(), view, [](auto &...comp) { ((comp.x = {}), ...); });
 }
 
-TEST(Benchmark, Create) {
-    entt::registry registry;
+template<std::size_t... Index>
+void insert_components(entt::registry &registry, const std::vector<entt::entity> &entity, std::index_sequence<Index...>) {
+    (registry.insert<comp<Index>>(entity.begin(), entity.end()), ...);
+}
 
-    std::cout << "Creating 1000000 entities" << std::endl;
+template<std::size_t... Index>
+auto view_of(entt::registry &registry, std::index_sequence<Index...>) {
+    return registry.view<comp<Index>...>();
+}
 
-    generic_with([&]() {
-        for(std::uint64_t i = 0; i < 1000000L; i++) {
-            static_cast<void>(registry.create());
-        }
+template<typename Func>
+void with_components(const std::size_t count, Func func) {
+    switch(count) {
+    case 1u:
+        func(std::make_index_sequence<1u>{});
+        break;
+    case 2u:
+        func(std::make_index_sequence<2u>{});
+        break;
+    case 3u:
+        func(std::make_index_sequence<3u>{});
+        break;
+    default:
+        ASSERT_EQ(count, 5u);
+        func(std::make_index_sequence<5u>{});
+        break;
+    }
+}
+
+TEST(Benchmark, Create) {
+    test::benchmark(1000000u, [](auto &&measure) {
+        entt::registry registry;
+
+        measure([&]() {
+            for(std::uint64_t i = 0; i < 1000000L; i++) {
+                static_cast<void>(registry.create());
+            }
+        });
     });
 }
 
 TEST(Benchmark, CreateMany) {
-    entt::registry registry;
-    std::vector<entt::entity> entity(1000000);
+    test::benchmark(1000000u, [](auto &&measure) {
+        entt::registry registry;
+        std::vector<entt::entity> entity(1000000);
 
-    std::cout << "Creating 1000000 entities at once" << std::endl;
-
-    generic_with([&]() {
-        registry.create(entity.begin(), entity.end());
+        measure([&]() {
+            registry.create(entity.begin(), entity.end());
+        });
     });
 }
 
 TEST(Benchmark, CreateManyAndEmplaceComponents) {
-    entt::registry registry;
-    std::vector<entt::entity> entity(1000000);
+    test::benchmark(1000000u, [](auto &&measure) {
+        entt::registry registry;
+        std::vector<entt::entity> entity(1000000);
 
-    std::cout << "Creating 1000000 entities at once and emplace components" << std::endl;
+        measure([&]() {
+            registry.create(entity.begin(), entity.end());
 
-    generic_with([&]() {
-        registry.create(entity.begin(), entity.end());
-
-        for(const auto entt: entity) {
-            registry.emplace<position>(entt);
-            registry.emplace<velocity>(entt);
-        }
+            for(const auto entt: entity) {
+                registry.emplace<position>(entt);
+                registry.emplace<velocity>(entt);
+            }
+        });
     });
 }
 
 TEST(Benchmark, CreateManyWithComponents) {
-    entt::registry registry;
-    std::vector<entt::entity> entity(1000000);
+    test::benchmark(1000000u, [](auto &&measure) {
+        entt::registry registry;
+        std::vector<entt::entity> entity(1000000);
+
+        measure([&]() {
+            registry.create(entity.begin(), entity.end());
+            registry.insert<position>(entity.begin(), entity.end());
+            registry.insert<velocity>(entity.begin(), entity.end());
+        });
+    });
+}
 
-    std::cout << "Creating 1000000 entities at once with components" << std::endl;
+TEST(Benchmark, Erase) {
+    test::benchmark(1000000u, [](auto &&measure) {
+        entt::registry registry;
+        std::vector<entt::entity> entity(1000000);
+        auto view = registry.view<position>();
 
-    generic_with([&]() {
         registry.create(entity.begin(), entity.end());
         registry.insert<position>(entity.begin(), entity.end());
-        registry.insert<velocity>(entity.begin(), entity.end());
+
+        measure([&]() {
+            for(auto entt: view) {
+                registry.erase<position>(entt);
+            }
+        });
     });
 }
 
-TEST(Benchmark, Erase) {
-    entt::registry registry;
-    std::vector<entt::entity> entity(1000000);
-    auto view = registry.view<position>();
+TEST(Benchmark, EraseOneByOne) {
+    test::benchmark(1000000u, [](auto &&measure) {
+        entt::registry registry;
+        std::vector<entt::entity> entity(1000000);
 
-    std::cout << "Erasing 1000000 components from their entities" << std::endl;
-
-    registry.create(entity.begin(), entity.end());
-    registry.insert<position>(entity.begin(), entity.end());
+        registry.create(entity.begin(), entity.end());
+        registry.insert<position>(entity.begin(), entity.end());
 
-    generic_with([&]() {
-        for(auto entt: view) {
-            registry.erase<position>(entt);
-        }
+        measure([&]() {
+            // lowest positions first, the worst case for a compaction pass
+            for(auto entt: entity) {
+                registry.erase<position>(entt);
+            }
+        });
     });
 }
 
 TEST(Benchmark, EraseMany) {
-    entt::registry registry;
-    std::vector<entt::entity> entity(1000000);
-    auto view = registry.view<position>();
-
-    std::cout << "Erasing 1000000 components from their entities at once" << std::endl;
+    test::benchmark(1000000u, [](auto &&measure) {
+        entt::registry registry;
+        std::vector<entt::entity> entity(1000000);
+        auto view = registry.view<position>();
 
-    registry.create(entity.begin(), entity.end());
-    registry.insert<position>(entity.begin(), entity.end());
+        registry.create(entity.begin(), entity.end());
+        registry.insert<position>(entity.begin(), entity.end());
 
-    generic_with([&]() {
-        registry.erase<position>(view.begin(), view.end());
+        measure([&]() {
+            registry.erase<position>(view.begin(), view.end());
+        });
     });
 }
 
 TEST(Benchmark, EraseManyMulti) {
-    entt::registry registry;
-    std::vector<entt::entity> entity(1000000);
-    auto view = registry.view<position>();
+    test::benchmark(1000000u, [](auto &&measure) {
+        entt::registry registry;
+        std::vector<entt::entity> entity(1000000);
+        auto view = registry.view<position>();
 
-    std::cout << "Erasing 1000000 components per type from their entities at once" << std::endl;
-
-    registry.create(entity.begin(), entity.end());
-    registry.insert<position>(entity.begin(), entity.end());
-    registry.insert<velocity>(entity.begin(), entity.end());
+        registry.create(entity.begin(), entity.end());
+        registry.insert<position>(entity.begin(), entity.end());
+        registry.insert<velocity>(entity.begin(), entity.end());
 
-    generic_with([&]() {
-        registry.erase<position, velocity>(view.begin(), view.end());
+        measure([&]() {
+            registry.erase<position, velocity>(view.begin(), view.end());
+        });
     });
 }
 
 TEST(Benchmark, Remove) {
-    entt::registry registry;
-    std::vector<entt::entity> entity(1000000);
-    auto view = registry.view<position>();
-
-    std::cout << "Removing 1000000 components from their entities" << std::endl;
+    test::benchmark(1000000u, [](auto &&measure) {
+        entt::registry registry;
+        std::vector<entt::entity> entity(1000000);
+        auto view = registry.view<position>();
 
-    registry.create(entity.begin(), entity.end());
-    registry.insert<position>(entity.begin(), entity.end());
+        registry.create(entity.begin(), entity.end());
+        registry.insert<position>(entity.begin(), entity.end());
 
-    generic_with([&]() {
-        for(auto entt: view) {
-            registry.remove<position>(entt);
-        }
+        measure([&]() {
+            for(auto entt: view) {
+                registry.remove<position>(entt);
+            }
+        });
     });
 }
 
 TEST(Benchmark, RemoveMany) {
-    entt::registry registry;
-    std::vector<entt::entity> entity(1000000);
-    auto view = registry.view<position>();
-
-    std::cout << "Removing 1000000 components from their entities at once" << std::endl;
+    test::benchmark(1000000u, [](auto &&measure) {
+        entt::registry registry;
+        std::vector<entt::entity> entity(1000000);
+        auto view = registry.view<position>();
 
-    registry.create(entity.begin(), entity.end());
-    registry.insert<position>(entity.begin(), entity.end());
+        registry.create(entity.begin(), entity.end());
+        registry.insert<position>(entity.begin(), entity.end());
 
-    generic_with([&]() {
-        registry.remove<position>(view.begin(), view.end());
+        measure([&]() {
+            registry.remove<position>(view.begin(), view.end());
+        });
     });
 }
 
 TEST(Benchmark, RemoveManyMulti) {
-    entt::registry registry;
-    std::vector<entt::entity> entity(1000000);
-    auto view = registry.view<position>();
-
-    std::cout << "Removing 1000000 components per type from their entities at once" << std::endl;
+    test::benchmark(1000000u, [](auto &&measure) {
+        entt::registry registry;
+        std::vector<entt::entity> entity(1000000);
+        auto view = registry.view<position>();
 
-    registry.create(entity.begin(), entity.end());
-    registry.insert<position>(entity.begin(), entity.end());
-    registry.insert<velocity>(entity.begin(), entity.end());
+        registry.create(entity.begin(), entity.end());
+        registry.insert<position>(entity.begin(), entity.end());
+        registry.insert<velocity>(entity.begin(), entity.end());
 
-    generic_with([&]() {
-        registry.remove<position, velocity>(view.begin(), view.end());
+        measure([&]() {
+            registry.remove<position, velocity>(view.begin(), view.end());
+        });
     });
 }
 
 TEST(Benchmark, Clear) {
-    entt::registry registry;
-    std::vector<entt::entity> entity(1000000);
-
-    std::cout << "Clearing 1000000 components from their entities" << std::endl;
+    test::benchmark(1000000u, [](auto &&measure) {
+        entt::registry registry;
+        std::vector<entt::entity> entity(1000000);
 
-    registry.create(entity.begin(), entity.end());
-    registry.insert<position>(entity.begin(), entity.end());
+        registry.create(entity.begin(), entity.end());
+        registry.insert<position>(entity.begin(), entity.end());
 
-    generic_with([&]() {
-        registry.clear<position>();
+        measure([&]() {
+            registry.clear<position>();
+        });
     });
 }
 
 TEST(Benchmark, ClearMulti) {
-    entt::registry registry;
-    std::vector<entt::entity> entity(1000000);
-
-    std::cout << "Clearing 1000000 components per type from their entities" << std::endl;
+    test::benchmark(1000000u, [](auto &&measure) {
+        entt::registry registry;
+        std::vector<entt::entity> entity(1000000);
 
-    registry.create(entity.begin(), entity.end());
-    registry.insert<position>(entity.begin(), entity.end());
-    registry.insert<velocity>(entity.begin(), entity.end());
+        registry.create(entity.begin(), entity.end());
+        registry.insert<position>(entity.begin(), entity.end());
+        registry.insert<velocity>(entity.begin(), entity.end());
 
-    generic_with([&]() {
-        registry.clear<position, velocity>();
+        measure([&]() {
+            registry.clear<position, velocity>();
+        });
     });
 }
 
 TEST(Benchmark, ClearStable) {
-    entt::registry registry;
-    std::vector<entt::entity> entity(1000000);
-
-    std::cout << "Clearing 1000000 stable components from their entities" << std::endl;
+    test::benchmark(1000000u, [](auto &&measure) {
+        entt::registry registry;
+        std::vector<entt::entity> entity(1000000);
 
-    registry.create(entity.begin(), entity.end());
-    registry.insert<stable_position>(entity.begin(), entity.end());
+        registry.create(entity.begin(), entity.end());
+        registry.insert<stable_position>(entity.begin(), entity.end());
 
-    generic_with([&]() {
-        registry.clear<stable_position>();
+        measure([&]() {
+            registry.clear<stable_position>();
+        });
     });
 }
 
 TEST(Benchmark, Recycle) {
-    entt::registry registry;
-    std::vector<entt::entity> entity(1000000);
-
-    std::cout << "Recycling 1000000 entities" << std::endl;
+    test::benchmark(1000000u, [](auto &&measure) {
+        entt::registry registry;
+        std::vector<entt::entity> entity(1000000);
 
-    registry.create(entity.begin(), entity.end());
-    registry.destroy(entity.begin(), entity.end());
+        registry.create(entity.begin(), entity.end());
+        registry.destroy(entity.begin(), entity.end());
 
-    generic_with([&]() {
-        for(auto next = entity.size(); next; --next) {
-            entity[next] = registry.create();
-        }
+        measure([&]() {
+            for(auto next = entity.size(); next; --next) {
+                entity[next - 1u] = registry.create();
+            }
+        });
     });
 }
 
 TEST(Benchmark, RecycleMany) {
-    entt::registry registry;
-    std::vector<entt::entity> entity(1000000);
+    test::benchmark(1000000u, [](auto &&measure) {
+        entt::registry registry;
+        std::vector<entt::entity> entity(1000000);
 
-    std::cout << "Recycling 1000000 entities" << std::endl;
-
-    registry.create(entity.begin(), entity.end());
-    registry.destroy(entity.begin(), entity.end());
-
-    generic_with([&]() {
         registry.create(entity.begin(), entity.end());
+        registry.destroy(entity.begin(), entity.end());
+
+        measure([&]() {
+            registry.create(entity.begin(), entity.end());
+        });
     });
 }
 
 TEST(Benchmark, Destroy) {
-    entt::registry registry;
-    std::vector<entt::entity> entity(1000000);
-    auto view = registry.view<position>();
-
-    std::cout << "Destroying 1000000 entities" << std::endl;
+    test::benchmark(1000000u, [](auto &&measure) {
+        entt::registry registry;
+        std::vector<entt::entity> entity(1000000);
+        auto view = registry.view<position>();
 
-    registry.create(entity.begin(), entity.end());
-    registry.insert<position>(entity.begin(), entity.end());
+        registry.create(entity.begin(), entity.end());
+        registry.insert<position>(entity.begin(), entity.end());
 
-    generic_with([&]() {
-        for(auto entt: view) {
-            registry.destroy(entt);
-        }
+        measure([&]() {
+            for(auto entt: view) {
+                registry.destroy(entt);
+            }
+        });
     });
 }
 
 TEST(Benchmark, DestroyMany) {
-    entt::registry registry;
-    std::vector<entt::entity> entity(1000000);
-    auto view = registry.view<position>();
-
-    std::cout << "Destroying 1000000 entities at once" << std::endl;
+    test::benchmark(1000000u, [](auto &&measure) {
+        entt::registry registry;
+        std::vector<entt::entity> entity(1000000);
+        auto view = registry.view<position>();
 
-    registry.create(entity.begin(), entity.end());
-    registry.insert<position>(entity.begin(), entity.end());
+        registry.create(entity.begin(), entity.end());
+        registry.insert<position>(entity.begin(), entity.end());
 
-    generic_with([&]() {
-        registry.destroy(view.begin(), view.end());
+        measure([&]() {
+            registry.destroy(view.begin(), view.end());
+        });
     });
 }
 
 TEST(Benchmark, DestroyManyMulti) {
-    entt::registry registry;
-    std::vector<entt::entity> entity(1000000);
-    auto view = registry.view<position>();
-
-    std::cout << "Destroying 1000000 entities at once, multiple components" << std::endl;
+    test::benchmark(1000000u, [](auto &&measure) {
+        entt::registry registry;
+        std::vector<entt::entity> entity(1000000);
+        auto view = registry.view<position>();
 
-    registry.create(entity.begin(), entity.end());
-    registry.insert<position>(entity.begin(), entity.end());
-    registry.insert<velocity>(entity.begin(), entity.end());
+        registry.create(entity.begin(), entity.end());
+        registry.insert<position>(entity.begin(), entity.end());
+        registry.insert<velocity>(entity.begin(), entity.end());
 
-    generic_with([&]() {
-        registry.destroy(view.begin(), view.end());
+        measure([&]() {
+            registry.destroy(view.begin(), view.end());
+        });
     });
 }
 
 TEST(Benchmark, GetFromRegistry) {
-    entt::registry registry;
-    std::vector<entt::entity> entity(1000000);
+    test::benchmark(1000000u, [](auto &&measure) {
+        entt::registry registry;
+        std::vector<entt::entity> entity(1000000);
 
-    std::cout << "Getting data for 1000000 entities from a registry, one component" << std::endl;
-
-    registry.create(entity.begin(), entity.end());
-    registry.insert<position>(entity.begin(), entity.end());
+        registry.create(entity.begin(), entity.end());
+        registry.insert<position>(entity.begin(), entity.end());
 
-    generic_with([&]() {
-        for(auto entt: entity) {
-            registry.get<position>(entt).x = 0u;
-        }
+        measure([&]() {
+            for(auto entt: entity) {
+                registry.get<position>(entt).x = 0u;
+            }
+        });
     });
 }
 
 TEST(Benchmark, GetFromRegistryMulti) {
-    entt::registry registry;
-    std::vector<entt::entity> entity(1000000);
-
-    std::cout << "Getting data for 1000000 entities from a registry, multiple components" << std::endl;
+    test::benchmark(1000000u, [](auto &&measure) {
+        entt::registry registry;
+        std::vector<entt::entity> entity(1000000);
 
-    registry.create(entity.begin(), entity.end());
-    registry.insert<position>(entity.begin(), entity.end());
-    registry.insert<velocity>(entity.begin(), entity.end());
+        registry.create(entity.begin(), entity.end());
+        registry.insert<position>(entity.begin(), entity.end());
+        registry.insert<velocity>(entity.begin(), entity.end());
 
-    generic_with([&]() {
-        for(auto entt: entity) {
-            registry.get<position>(entt).x = 0u;
-            registry.get<velocity>(entt).y = 0u;
-        }
+        measure([&]() {
+            for(auto entt: entity) {
+                registry.get<position>(entt).x = 0u;
+                registry.get<velocity>(entt).y = 0u;
+            }
+        });
     });
 }
 
 TEST(Benchmark, GetFromView) {
-    entt::registry registry;
-    std::vector<entt::entity> entity(1000000);
-    auto view = registry.view<position>();
-
-    std::cout << "Getting data for 1000000 entities from a view, one component" << std::endl;
+    test::benchmark(1000000u, [](auto &&measure) {
+        entt::registry registry;
+        std::vector<entt::entity> entity(1000000);
+        auto view = registry.view<position>();
 
-    registry.create(entity.begin(), entity.end());
-    registry.insert<position>(entity.begin(), entity.end());
+        registry.create(entity.begin(), entity.end());
+        registry.insert<position>(entity.begin(), entity.end());
 
-    generic_with([&]() {
-        for(auto entt: entity) {
-            view.get<position>(entt).x = 0u;
-        }
+        measure([&]() {
+            for(auto entt: entity) {
+                view.get<position>(entt).x = 0u;
+            }
+        });
     });
 }
 
 TEST(Benchmark, GetFromViewMulti) {
-    entt::registry registry;
-    std::vector<entt::entity> entity(1000000);
-    auto view = registry.view<position, velocity>();
+    test::benchmark(1000000u, [](auto &&measure) {
+        entt::registry registry;
+        std::vector<entt::entity> entity(1000000);
+        auto view = registry.view<position, velocity>();
 
-    std::cout << "Getting data for 1000000 entities from a view, multiple components" << std::endl;
-
-    registry.create(entity.begin(), entity.end());
-    registry.insert<position>(entity.begin(), entity.end());
-    registry.insert<velocity>(entity.begin(), entity.end());
+        registry.create(entity.begin(), entity.end());
+        registry.insert<position>(entity.begin(), entity.end());
+        registry.insert<velocity>(entity.begin(), entity.end());
 
-    generic_with([&]() {
-        for(auto entt: entity) {
-            view.get<position>(entt).x = 0u;
-            view.get<velocity>(entt).y = 0u;
-        }
+        measure([&]() {
+            for(auto entt: entity) {
+                view.get<position>(entt).x = 0u;
+                view.get<velocity>(entt).y = 0u;
+            }
+        });
     });
 }
 
 TEST(Benchmark, IterateSingleComponent1M) {
     entt::registry registry;
 
-    std::cout << "Iterating over 1000000 entities, one component" << std::endl;
-
     for(std::uint64_t i = 0; i < 1000000L; i++) {
         const auto entt = registry.create();
         registry.emplace<position>(entt);
     }
 
-    iterate_with(registry.view<position>(), [](auto &...comp) {
+    iterate_with(1000000u, registry.view<position>(), [](auto &...comp) {
         ((comp.x = {}), ...);
     });
 }
@@ -453,14 +477,12 @@ TEST(Benchmark, IterateSingleComponent1M) {
 TEST(Benchmark, IterateSingleStableComponent1M) {
     entt::registry registry;
 
-    std::cout << "Iterating over 1000000 entities, one stable component" << std::endl;
-
     for(std::uint64_t i = 0; i < 1000000L; i++) {
         const auto entt = registry.create();
         registry.emplace<stable_position>(entt);
     }
 
-    iterate_with(registry.view<stable_position>(), [](auto &...comp) {
+    iterate_with(1000000u, registry.view<stable_position>(), [](auto &...comp) {
         ((comp.x = {}), ...);
     });
 }
@@ -468,8 +490,6 @@ TEST(Benchmark, IterateSingleStableComponent1M) {
 TEST(Benchmark, IterateSingleComponentRuntime1M) {
     entt::registry registry;
 
-    std::cout << "Iterating over 1000000 entities, one component, runtime view" << std::endl;
-
     for(std::uint64_t i = 0; i < 1000000L; i++) {
         const auto entt = registry.create();
         registry.emplace<position>(entt);
@@ -478,7 +498,7 @@ TEST(Benchmark, IterateSingleComponentRuntime1M) {
     entt::runtime_view view{};
     view.iterate(registry.storage<position>());
 
-    iterate_with(view, [&](auto entt) {
+    iterate_with(1000000u, view, [&](auto entt) {
         registry.get<position>(entt).x = {};
     });
 }
@@ -486,15 +506,13 @@ TEST(Benchmark, IterateSingleComponentRuntime1M) {
 TEST(Benchmark, IterateTwoComponents1M) {
     entt::registry registry;
 
-    std::cout << "Iterating over 1000000 entities, two components" << std::endl;
-
     for(std::uint64_t i = 0; i < 1000000L; i++) {
         const auto entt = registry.create();
         registry.emplace<position>(entt);
         registry.emplace<velocity>(entt);
     }
 
-    iterate_with(registry.view<position, velocity>(), [](auto &...comp) {
+    iterate_with(1000000u, registry.view<position, velocity>(), [](auto &...comp) {
         ((comp.x = {}), ...);
     });
 }
@@ -502,15 +520,13 @@ TEST(Benchmark, IterateTwoComponents1M) {
 TEST(Benchmark, IterateTwoStableComponents1M) {
     entt::registry registry;
 
-    std::cout << "Iterating over 1000000 entities, two stable components" << std::endl;
-
     for(std::uint64_t i = 0; i < 1000000L; i++) {
         const auto entt = registry.create();
         registry.emplace<stable_position>(entt);
         registry.emplace<velocity>(entt);
     }
 
-    iterate_with(registry.view<stable_position, velocity>(), [](auto &...comp) {
+    iterate_with(1000000u, registry.view<stable_position, velocity>(), [](auto &...comp) {
         ((comp.x = {}), ...);
     });
 }
@@ -518,8 +534,6 @@ TEST(Benchmark, IterateTwoStableComponents1M) {
 TEST(Benchmark, IterateTwoComponents1MHalf) {
     entt::registry registry;
 
-    std::cout << "Iterating over 1000000 entities, two components, half of the entities have all the components" << std::endl;
-
     for(std::uint64_t i = 0; i < 1000000L; i++) {
         const auto entt = registry.create();
         registry.emplace<velocity>(entt);
@@ -529,7 +543,7 @@ TEST(Benchmark, IterateTwoComponents1MHalf) {
         }
     }
 
-    iterate_with(registry.view<position, velocity>(), [](auto &...comp) {
+    iterate_with(1000000u, registry.view<position, velocity>(), [](auto &...comp) {
         ((comp.x = {}), ...);
     });
 }
@@ -537,8 +551,6 @@ TEST(Benchmark, IterateTwoComponents1MHalf) {
 TEST(Benchmark, IterateTwoComponents1MOne) {
     entt::registry registry;
 
-    std::cout << "Iterating over 1000000 entities, two components, only one entity has all the components" << std::endl;
-
     for(std::uint64_t i = 0; i < 1000000L; i++) {
         const auto entt = registry.create();
         registry.emplace<velocity>(entt);
@@ -548,7 +560,7 @@ TEST(Benchmark, IterateTwoComponents1MOne) {
         }
     }
 
-    iterate_with(registry.view<position, velocity>(), [](auto &...comp) {
+    iterate_with(1000000u, registry.view<position, velocity>(), [](auto &...comp) {
         ((comp.x = {}), ...);
     });
 }
@@ -556,15 +568,13 @@ TEST(Benchmark, IterateTwoComponents1MOne) {
 TEST(Benchmark, IterateTwoComponentsNonOwningGroup1M) {
     entt::registry registry;
 
-    std::cout << "Iterating over 1000000 entities, two components, non owning group" << std::endl;
-
     for(std::uint64_t i = 0; i < 1000000L; i++) {
         const auto entt = registry.create();
         registry.emplace<position>(entt);
         registry.emplace<velocity>(entt);
     }
 
-    iterate_with(registry.group<>(entt::get<position, velocity>), [](auto &...comp) {
+    iterate_with(1000000u, registry.group<>(entt::get<position, velocity>), [](auto &...comp) {
         ((comp.x = {}), ...);
     });
 }
@@ -572,15 +582,13 @@ TEST(Benchmark, IterateTwoComponentsNonOwningGroup1M) {
 TEST(Benchmark, IterateTwoComponentsFullOwningGroup1M) {
     entt::registry registry;
 
-    std::cout << "Iterating over 1000000 entities, two components, full owning group" << std::endl;
-
     for(std::uint64_t i = 0; i < 1000000L; i++) {
         const auto entt = registry.create();
         registry.emplace<position>(entt);
         registry.emplace<velocity>(entt);
     }
 
-    iterate_with(registry.group<position, velocity>(), [](auto &...comp) {
+    iterate_with(1000000u, registry.group<position, velocity>(), [](auto &...comp) {
         ((comp.x = {}), ...);
     });
 }
@@ -588,15 +596,13 @@ TEST(Benchmark, IterateTwoComponentsFullOwningGroup1M) {
 TEST(Benchmark, IterateTwoComponentsPartialOwningGroup1M) {
     entt::registry registry;
 
-    std::cout << "Iterating over 1000000 entities, two components, partial owning group" << std::endl;
-
     for(std::uint64_t i = 0; i < 1000000L; i++) {
         const auto entt = registry.create();
         registry.emplace<position>(entt);
         registry.emplace<velocity>(entt);
     }
 
-    iterate_with(registry.group<position>(entt::get<velocity>), [](auto &...comp) {
+    iterate_with(1000000u, registry.group<position>(entt::get<velocity>), [](auto &...comp) {
         ((comp.x = {}), ...);
     });
 }
@@ -604,8 +610,6 @@ TEST(Benchmark, IterateTwoComponentsPartialOwningGroup1M) {
 TEST(Benchmark, IterateTwoComponentsRuntime1M) {
     entt::registry registry;
 
-    std::cout << "Iterating over 1000000 entities, two components, runtime view" << std::endl;
-
     for(std::uint64_t i = 0; i < 1000000L; i++) {
         const auto entt = registry.create();
         registry.emplace<position>(entt);
@@ -616,7 +620,7 @@ TEST(Benchmark, IterateTwoComponentsRuntime1M) {
     view.iterate(registry.storage<position>())
         .iterate(registry.storage<velocity>());
 
-    iterate_with(view, [&](auto entt) {
+    iterate_with(1000000u, view, [&](auto entt) {
         registry.get<position>(entt).x = {};
         registry.get<velocity>(entt).x = {};
     });
@@ -625,8 +629,6 @@ TEST(Benchmark, IterateTwoComponentsRuntime1M) {
 TEST(Benchmark, IterateTwoComponentsRuntime1MHalf) {
     entt::registry registry;
 
-    std::cout << "Iterating over 1000000 entities, two components, half of the entities have all the components, runtime view" << std::endl;
-
     for(std::uint64_t i = 0; i < 1000000L; i++) {
         const auto entt = registry.create();
         registry.emplace<velocity>(entt);
@@ -640,7 +642,7 @@ TEST(Benchmark, IterateTwoComponentsRuntime1MHalf) {
     view.iterate(registry.storage<position>())
         .iterate(registry.storage<velocity>());
 
-    iterate_with(view, [&](auto entt) {
+    iterate_with(1000000u, view, [&](auto entt) {
         registry.get<position>(entt).x = {};
         registry.get<velocity>(entt).x = {};
     });
@@ -649,8 +651,6 @@ TEST(Benchmark, IterateTwoComponentsRuntime1MHalf) {
 TEST(Benchmark, IterateTwoComponentsRuntime1MOne) {
     entt::registry registry;
 
-    std::cout << "Iterating over 1000000 entities, two components, only one entity has all the components, runtime view" << std::endl;
-
     for(std::uint64_t i = 0; i < 1000000L; i++) {
         const auto entt = registry.create();
         registry.emplace<velocity>(entt);
@@ -664,7 +664,7 @@ TEST(Benchmark, IterateTwoComponentsRuntime1MOne) {
     view.iterate(registry.storage<position>())
         .iterate(registry.storage<velocity>());
 
-    iterate_with(view, [&](auto entt) {
+    iterate_with(1000000u, view, [&](auto entt) {
         registry.get<position>(entt).x = {};
         registry.get<velocity>(entt).x = {};
     });
@@ -673,8 +673,6 @@ TEST(Benchmark, IterateTwoComponentsRuntime1MOne) {
 TEST(Benchmark, IterateThreeComponents1M) {
     entt::registry registry;
 
-    std::cout << "Iterating over 1000000 entities, three components" << std::endl;
-
     for(std::uint64_t i = 0; i < 1000000L; i++) {
         const auto entt = registry.create();
         registry.emplace<position>(entt);
@@ -682,7 +680,7 @@ TEST(Benchmark, IterateThreeComponents1M) {
         registry.emplace<comp<0>>(entt);
     }
 
-    iterate_with(registry.view<position, velocity, comp<0>>(), [](auto &...comp) {
+    iterate_with(1000000u, registry.view<position, velocity, comp<0>>(), [](auto &...comp) {
         ((comp.x = {}), ...);
     });
 }
@@ -690,8 +688,6 @@ TEST(Benchmark, IterateThreeComponents1M) {
 TEST(Benchmark, IterateThreeStableComponents1M) {
     entt::registry registry;
 
-    std::cout << "Iterating over 1000000 entities, three stable components" << std::endl;
-
     for(std::uint64_t i = 0; i < 1000000L; i++) {
         const auto entt = registry.create();
         registry.emplace<stable_position>(entt);
@@ -699,7 +695,7 @@ TEST(Benchmark, IterateThreeStableComponents1M) {
         registry.emplace<comp<0>>(entt);
     }
 
-    iterate_with(registry.view<stable_position, velocity, comp<0>>(), [](auto &...comp) {
+    iterate_with(1000000u, registry.view<stable_position, velocity, comp<0>>(), [](auto &...comp) {
         ((comp.x = {}), ...);
     });
 }
@@ -707,8 +703,6 @@ TEST(Benchmark, IterateThreeStableComponents1M) {
 TEST(Benchmark, IterateThreeComponents1MHalf) {
     entt::registry registry;
 
-    std::cout << "Iterating over 1000000 entities, three components, half of the entities have all the components" << std::endl;
-
     for(std::uint64_t i = 0; i < 1000000L; i++) {
         const auto entt = registry.create();
         registry.emplace<velocity>(entt);
@@ -719,7 +713,7 @@ TEST(Benchmark, IterateThreeComponents1MHalf) {
         }
     }
 
-    iterate_with(registry.view<position, velocity, comp<0>>(), [](auto &...comp) {
+    iterate_with(1000000u, registry.view<position, velocity, comp<0>>(), [](auto &...comp) {
         ((comp.x = {}), ...);
     });
 }
@@ -727,8 +721,6 @@ TEST(Benchmark, IterateThreeComponents1MHalf) {
 TEST(Benchmark, IterateThreeComponents1MOne) {
     entt::registry registry;
 
-    std::cout << "Iterating over 1000000 entities, three components, only one entity has all the components" << std::endl;
-
     for(std::uint64_t i = 0; i < 1000000L; i++) {
         const auto entt = registry.create();
         registry.emplace<velocity>(entt);
@@ -739,7 +731,7 @@ TEST(Benchmark, IterateThreeComponents1MOne) {
         }
     }
 
-    iterate_with(registry.view<position, velocity, comp<0>>(), [](auto &...comp) {
+    iterate_with(1000000u, registry.view<position, velocity, comp<0>>(), [](auto &...comp) {
         ((comp.x = {}), ...);
     });
 }
@@ -747,8 +739,6 @@ TEST(Benchmark, IterateThreeComponents1MOne) {
 TEST(Benchmark, IterateThreeComponentsNonOwningGroup1M) {
     entt::registry registry;
 
-    std::cout << "Iterating over 1000000 entities, three components, non owning group" << std::endl;
-
     for(std::uint64_t i = 0; i < 1000000L; i++) {
         const auto entt = registry.create();
         registry.emplace<position>(entt);
@@ -756,7 +746,7 @@ TEST(Benchmark, IterateThreeComponentsNonOwningGroup1M) {
         registry.emplace<comp<0>>(entt);
     }
 
-    iterate_with(registry.group<>(entt::get<position, velocity, comp<0>>), [](auto &...comp) {
+    iterate_with(1000000u, registry.group<>(entt::get<position, velocity, comp<0>>), [](auto &...comp) {
         ((comp.x = {}), ...);
     });
 }
@@ -764,8 +754,6 @@ TEST(Benchmark, IterateThreeComponentsNonOwningGroup1M) {
 TEST(Benchmark, IterateThreeComponentsFullOwningGroup1M) {
     entt::registry registry;
 
-    std::cout << "Iterating over 1000000 entities, three components, full owning group" << std::endl;
-
     for(std::uint64_t i = 0; i < 1000000L; i++) {
         const auto entt = registry.create();
         registry.emplace<position>(entt);
@@ -773,7 +761,7 @@ TEST(Benchmark, IterateThreeComponentsFullOwningGroup1M) {
         registry.emplace<comp<0>>(entt);
     }
 
-    iterate_with(registry.group<position, velocity, comp<0>>(), [](auto &...comp) {
+    iterate_with(1000000u, registry.group<position, velocity, comp<0>>(), [](auto &...comp) {
         ((comp.x = {}), ...);
     });
 }
@@ -781,8 +769,6 @@ TEST(Benchmark, IterateThreeComponentsFullOwningGroup1M) {
 TEST(Benchmark, IterateThreeComponentsPartialOwningGroup1M) {
     entt::registry registry;
 
-    std::cout << "Iterating over 1000000 entities, three components, partial owning group" << std::endl;
-
     for(std::uint64_t i = 0; i < 1000000L; i++) {
         const auto entt = registry.create();
         registry.emplace<position>(entt);
@@ -790,7 +776,7 @@ TEST(Benchmark, IterateThreeComponentsPartialOwningGroup1M) {
         registry.emplace<comp<0>>(entt);
     }
 
-    iterate_with(registry.group<position, velocity>(entt::get<comp<0>>), [](auto &...comp) {
+    iterate_with(1000000u, registry.group<position, velocity>(entt::get<comp<0>>), [](auto &...comp) {
         ((comp.x = {}), ...);
     });
 }
@@ -798,8 +784,6 @@ TEST(Benchmark, IterateThreeComponentsPartialOwningGroup1M) {
 TEST(Benchmark, IterateThreeComponentsRuntime1M) {
     entt::registry registry;
 
-    std::cout << "Iterating over 1000000 entities, three components, runtime view" << std::endl;
-
     for(std::uint64_t i = 0; i < 1000000L; i++) {
         const auto entt = registry.create();
         registry.emplace<position>(entt);
@@ -812,7 +796,7 @@ TEST(Benchmark, IterateThreeComponentsRuntime1M) {
         .iterate(registry.storage<velocity>())
         .iterate(registry.storage<comp<0>>());
 
-    iterate_with(view, [&](auto entt) {
+    iterate_with(1000000u, view, [&](auto entt) {
         registry.get<position>(entt).x = {};
         registry.get<velocity>(entt).x = {};
         registry.get<comp<0>>(entt).x = {};
@@ -822,8 +806,6 @@ TEST(Benchmark, IterateThreeComponentsRuntime1M) {
 TEST(Benchmark, IterateThreeComponentsRuntime1MHalf) {
     entt::registry registry;
 
-    std::cout << "Iterating over 1000000 entities, three components, half of the entities have all the components, runtime view" << std::endl;
-
     for(std::uint64_t i = 0; i < 1000000L; i++) {
         const auto entt = registry.create();
         registry.emplace<velocity>(entt);
@@ -839,7 +821,7 @@ TEST(Benchmark, IterateThreeComponentsRuntime1MHalf) {
         .iterate(registry.storage<velocity>())
         .iterate(registry.storage<comp<0>>());
 
-    iterate_with(view, [&](auto entt) {
+    iterate_with(1000000u, view, [&](auto entt) {
         registry.get<position>(entt).x = {};
         registry.get<velocity>(entt).x = {};
         registry.get<comp<0>>(entt).x = {};
@@ -849,8 +831,6 @@ TEST(Benchmark, IterateThreeComponentsRuntime1MHalf) {
 TEST(Benchmark, IterateThreeComponentsRuntime1MOne) {
     entt::registry registry;
 
-    std::cout << "Iterating over 1000000 entities, three components, only one entity has all the components, runtime view" << std::endl;
-
     for(std::uint64_t i = 0; i < 1000000L; i++) {
         const auto entt = registry.create();
         registry.emplace<velocity>(entt);
@@ -866,7 +846,7 @@ TEST(Benchmark, IterateThreeComponentsRuntime1MOne) {
         .iterate(registry.storage<velocity>())
         .iterate(registry.storage<comp<0>>());
 
-    iterate_with(view, [&](auto entt) {
+    iterate_with(1000000u, view, [&](auto entt) {
         registry.get<position>(entt).x = {};
         registry.get<velocity>(entt).x = {};
         registry.get<comp<0>>(entt).x = {};
@@ -876,8 +856,6 @@ TEST(Benchmark, IterateThreeComponentsRuntime1MOne) {
 TEST(Benchmark, IterateFiveComponents1M) {
     entt::registry registry;
 
-    std::cout << "Iterating over 1000000 entities, five components" << std::endl;
-
     for(std::uint64_t i = 0; i < 1000000L; i++) {
         const auto entt = registry.create();
         registry.emplace<position>(entt);
@@ -887,7 +865,7 @@ TEST(Benchmark, IterateFiveComponents1M) {
         registry.emplace<comp<2>>(entt);
     }
 
-    iterate_with(registry.view<position, velocity, comp<0>, comp<1>, comp<2>>(), [](auto &...comp) {
+    iterate_with(1000000u, registry.view<position, velocity, comp<0>, comp<1>, comp<2>>(), [](auto &...comp) {
         ((comp.x = {}), ...);
     });
 }
@@ -895,8 +873,6 @@ TEST(Benchmark, IterateFiveComponents1M) {
 TEST(Benchmark, IterateFiveStableComponents1M) {
     entt::registry registry;
 
-    std::cout << "Iterating over 1000000 entities, five stable components" << std::endl;
-
     for(std::uint64_t i = 0; i < 1000000L; i++) {
         const auto entt = registry.create();
         registry.emplace<stable_position>(entt);
@@ -906,7 +882,7 @@ TEST(Benchmark, IterateFiveStableComponents1M) {
         registry.emplace<comp<2>>(entt);
     }
 
-    iterate_with(registry.view<stable_position, velocity, comp<0>, comp<1>, comp<2>>(), [](auto &...comp) {
+    iterate_with(1000000u, registry.view<stable_position, velocity, comp<0>, comp<1>, comp<2>>(), [](auto &...comp) {
         ((comp.x = {}), ...);
     });
 }
@@ -914,8 +890,6 @@ TEST(Benchmark, IterateFiveStableComponents1M) {
 TEST(Benchmark, IterateFiveComponents1MHalf) {
     entt::registry registry;
 
-    std::cout << "Iterating over 1000000 entities, five components, half of the entities have all the components" << std::endl;
-
     for(std::uint64_t i = 0; i < 1000000L; i++) {
         const auto entt = registry.create();
         registry.emplace<velocity>(entt);
@@ -928,7 +902,7 @@ TEST(Benchmark, IterateFiveComponents1MHalf) {
         }
     }
 
-    iterate_with(registry.view<position, velocity, comp<0>, comp<1>, comp<2>>(), [](auto &...comp) {
+    iterate_with(1000000u, registry.view<position, velocity, comp<0>, comp<1>, comp<2>>(), [](auto &...comp) {
         ((comp.x = {}), ...);
     });
 }
@@ -936,8 +910,6 @@ TEST(Benchmark, IterateFiveComponents1MHalf) {
 TEST(Benchmark, IterateFiveComponents1MOne) {
     entt::registry registry;
 
-    std::cout << "Iterating over 1000000 entities, five components, only one entity has all the components" << std::endl;
-
     for(std::uint64_t i = 0; i < 1000000L; i++) {
         const auto entt = registry.create();
         registry.emplace<velocity>(entt);
@@ -950,7 +922,7 @@ TEST(Benchmark, IterateFiveComponents1MOne) {
         }
     }
 
-    iterate_with(registry.view<position, velocity, comp<0>, comp<1>, comp<2>>(), [](auto &...comp) {
+    iterate_with(1000000u, registry.view<position, velocity, comp<0>, comp<1>, comp<2>>(), [](auto &...comp) {
         ((comp.x = {}), ...);
     });
 }
@@ -958,8 +930,6 @@ TEST(Benchmark, IterateFiveComponents1MOne) {
 TEST(Benchmark, IterateFiveComponentsNonOwningGroup1M) {
     entt::registry registry;
 
-    std::cout << "Iterating over 1000000 entities, five components, non owning group" << std::endl;
-
     for(std::uint64_t i = 0; i < 1000000L; i++) {
         const auto entt = registry.create();
         registry.emplace<position>(entt);
@@ -969,7 +939,7 @@ TEST(Benchmark, IterateFiveComponentsNonOwningGroup1M) {
         registry.emplace<comp<2>>(entt);
     }
 
-    iterate_with(registry.group<>(entt::get<position, velocity, comp<0>, comp<1>, comp<2>>), [](auto &...comp) {
+    iterate_with(1000000u, registry.group<>(entt::get<position, velocity, comp<0>, comp<1>, comp<2>>), [](auto &...comp) {
         ((comp.x = {}), ...);
     });
 }
@@ -977,8 +947,6 @@ TEST(Benchmark, IterateFiveComponentsNonOwningGroup1M) {
 TEST(Benchmark, IterateFiveComponentsFullOwningGroup1M) {
     entt::registry registry;
 
-    std::cout << "Iterating over 1000000 entities, five components, full owning group" << std::endl;
-
     for(std::uint64_t i = 0; i < 1000000L; i++) {
         const auto entt = registry.create();
         registry.emplace<position>(entt);
@@ -988,7 +956,7 @@ TEST(Benchmark, IterateFiveComponentsFullOwningGroup1M) {
         registry.emplace<comp<2>>(entt);
     }
 
-    iterate_with(registry.group<position, velocity, comp<0>, comp<1>, comp<2>>(), [](auto &...comp) {
+    iterate_with(1000000u, registry.group<position, velocity, comp<0>, comp<1>, comp<2>>(), [](auto &...comp) {
         ((comp.x = {}), ...);
     });
 }
@@ -996,8 +964,6 @@ TEST(Benchmark, IterateFiveComponentsFullOwningGroup1M) {
 TEST(Benchmark, IterateFiveComponentsPartialFourOfFiveOwningGroup1M) {
     entt::registry registry;
 
-    std::cout << "Iterating over 1000000 entities, five components, partial (4 of 5) owning group" << std::endl;
-
     for(std::uint64_t i = 0; i < 1000000L; i++) {
         const auto entt = registry.create();
         registry.emplace<position>(entt);
@@ -1007,7 +973,7 @@ TEST(Benchmark, IterateFiveComponentsPartialFourOfFiveOwningGroup1M) {
         registry.emplace<comp<2>>(entt);
     }
 
-    iterate_with(registry.group<position, velocity, comp<0>, comp<1>>(entt::get<comp<2>>), [](auto &...comp) {
+    iterate_with(1000000u, registry.group<position, velocity, comp<0>, comp<1>>(entt::get<comp<2>>), [](auto &...comp) {
         ((comp.x = {}), ...);
     });
 }
@@ -1015,8 +981,6 @@ TEST(Benchmark, IterateFiveComponentsPartialFourOfFiveOwningGroup1M) {
 TEST(Benchmark, IterateFiveComponentsPartialThreeOfFiveOwningGroup1M) {
     entt::registry registry;
 
-    std::cout << "Iterating over 1000000 entities, five components, partial (3 of 5) owning group" << std::endl;
-
     for(std::uint64_t i = 0; i < 1000000L; i++) {
         const auto entt = registry.create();
         registry.emplace<position>(entt);
@@ -1026,7 +990,7 @@ TEST(Benchmark, IterateFiveComponentsPartialThreeOfFiveOwningGroup1M) {
         registry.emplace<comp<2>>(entt);
     }
 
-    iterate_with(registry.group<position, velocity, comp<0>>(entt::get<comp<1>, comp<2>>), [](auto &...comp) {
+    iterate_with(1000000u, registry.group<position, velocity, comp<0>>(entt::get<comp<1>, comp<2>>), [](auto &...comp) {
         ((comp.x = {}), ...);
     });
 }
@@ -1034,8 +998,6 @@ TEST(Benchmark, IterateFiveComponentsPartialThreeOfFiveOwningGroup1M) {
 TEST(Benchmark, IterateFiveComponentsRuntime1M) {
     entt::registry registry;
 
-    std::cout << "Iterating over 1000000 entities, five components, runtime view" << std::endl;
-
     for(std::uint64_t i = 0; i < 1000000L; i++) {
         const auto entt = registry.create();
         registry.emplace<position>(entt);
@@ -1052,7 +1014,7 @@ TEST(Benchmark, IterateFiveComponentsRuntime1M) {
         .iterate(registry.storage<comp<1>>())
         .iterate(registry.storage<comp<2>>());
 
-    iterate_with(view, [&](auto entt) {
+    iterate_with(1000000u, view, [&](auto entt) {
         registry.get<position>(entt).x = {};
         registry.get<velocity>(entt).x = {};
         registry.get<comp<0>>(entt).x = {};
@@ -1064,8 +1026,6 @@ TEST(Benchmark, IterateFiveComponentsRuntime1M) {
 TEST(Benchmark, IterateFiveComponentsRuntime1MHalf) {
     entt::registry registry;
 
-    std::cout << "Iterating over 1000000 entities, five components, half of the entities have all the components, runtime view" << std::endl;
-
     for(std::uint64_t i = 0; i < 1000000L; i++) {
         const auto entt = registry.create();
         registry.emplace<velocity>(entt);
@@ -1085,7 +1045,7 @@ TEST(Benchmark, IterateFiveComponentsRuntime1MHalf) {
         .iterate(registry.storage<comp<1>>())
         .iterate(registry.storage<comp<2>>());
 
-    iterate_with(view, [&](auto entt) {
+    iterate_with(1000000u, view, [&](auto entt) {
         registry.get<position>(entt).x = {};
         registry.get<velocity>(entt).x = {};
         registry.get<comp<0>>(entt).x = {};
@@ -1097,8 +1057,6 @@ TEST(Benchmark, IterateFiveComponentsRuntime1MHalf) {
 TEST(Benchmark, IterateFiveComponentsRuntime1MOne) {
     entt::registry registry;
 
-    std::cout << "Iterating over 1000000 entities, five components, only one entity has all the components, runtime view" << std::endl;
-
     for(std::uint64_t i = 0; i < 1000000L; i++) {
         const auto entt = registry.create();
         registry.emplace<velocity>(entt);
@@ -1118,7 +1076,7 @@ TEST(Benchmark, IterateFiveComponentsRuntime1MOne) {
         .iterate(registry.storage<comp<1>>())
         .iterate(registry.storage<comp<2>>());
 
-    iterate_with(view, [&](auto entt) {
+    iterate_with(1000000u, view, [&](auto entt) {
         registry.get<position>(entt).x = {};
         registry.get<velocity>(entt).x = {};
         registry.get<comp<0>>(entt).x = {};
@@ -1128,106 +1086,166 @@ TEST(Benchmark, IterateFiveComponentsRuntime1MOne) {
 }
 
 TEST(Benchmark, IteratePathological) {
-    std::cout << "Pathological case" << std::endl;
     pathological_with([](auto &registry) { return registry.template view<position, velocity, comp<0>>(); });
 }
 
 TEST(Benchmark, IteratePathologicalNonOwningGroup) {
-    std::cout << "Pathological case (non-owning group)" << std::endl;
     pathological_with([](auto &registry) { return registry.template group<>(entt::get<position, velocity, comp<0>>); });
 }
 
 TEST(Benchmark, IteratePathologicalFullOwningGroup) {
-    std::cout << "Pathological case (full-owning group)" << std::endl;
     pathological_with([](auto &registry) { return registry.template group<position, velocity, comp<0>>(); });
 }
 
 TEST(Benchmark, IteratePathologicalPartialOwningGroup) {
-    std::cout << "Pathological case (partial-owning group)" << std::endl;
     pathological_with([](auto &registry) { return registry.template group<position, velocity>(entt::get<comp<0>>); });
 }
 
 TEST(Benchmark, SortSingle) {
-    entt::registry registry;
+    test::benchmark(150000u, [](auto &&measure) {
+        entt::registry registry;
 
-    std::cout << "Sort 150000 entities, one component" << std::endl;
-
-    for(std::uint64_t i = 0; i < 150000L; i++) {
-        const auto entt = registry.create();
-        registry.emplace<position>(entt, i, i);
-    }
+        for(std::uint64_t i = 0; i < 150000L; i++) {
+            const auto entt = registry.create();
+            registry.emplace<position>(entt, i, i);
+        }
 
-    generic_with([&]() {
-        registry.sort<position>([](const auto &lhs, const auto &rhs) { return lhs.x < rhs.x && lhs.y < rhs.y; });
+        measure([&]() {
+            registry.sort<position>([](const auto &lhs, const auto &rhs) { return lhs.x < rhs.x && lhs.y < rhs.y; });
+        });
     });
 }
 
 TEST(Benchmark, SortMulti) {
-    entt::registry registry;
+    test::benchmark(150000u, [](auto &&measure) {
+        entt::registry registry;
 
-    std::cout << "Sort 150000 entities, two components" << std::endl;
-
-    for(std::uint64_t i = 0; i < 150000L; i++) {
-        const auto entt = registry.create();
-        registry.emplace<position>(entt, i, i);
-        registry.emplace<velocity>(entt, i, i);
-    }
+        for(std::uint64_t i = 0; i < 150000L; i++) {
+            const auto entt = registry.create();
+            registry.emplace<position>(entt, i, i);
+            registry.emplace<velocity>(entt, i, i);
+        }
 
-    registry.sort<position>([](const auto &lhs, const auto &rhs) { return lhs.x < rhs.x && lhs.y < rhs.y; });
+        registry.sort<position>([](const auto &lhs, const auto &rhs) { return lhs.x < rhs.x && lhs.y < rhs.y; });
 
-    generic_with([&]() {
-        registry.sort<velocity, position>();
+        measure([&]() {
+            registry.sort<velocity, position>();
+        });
     });
 }
 
 TEST(Benchmark, AlmostSortedStdSort) {
-    entt::registry registry;
-    entt::entity entity[3]{};
+    test::benchmark(150000u, [](auto &&measure) {
+        entt::registry registry;
+        entt::entity entity[3]{};
 
-    std::cout << "Sort 150000 entities, almost sorted, std::sort" << std::endl;
-
-    for(std::uint64_t i = 0; i < 150000L; i++) {
-        const auto entt = registry.create();
-        registry.emplace<position>(entt, i, i);
+        for(std::uint64_t i = 0; i < 150000L; i++) {
+            const auto entt = registry.create();
+            registry.emplace<position>(entt, i, i);
 
-        if(!(i % 50000)) {
-            entity[i / 50000] = entt;
+            if(!(i % 50000)) {
+                entity[i / 50000] = entt;
+            }
         }
-    }
 
-    for(std::uint64_t i = 0; i < 3; ++i) {
-        registry.destroy(entity[i]);
-        const auto entt = registry.create();
-        registry.emplace<position>(entt, 50000 * i, 50000 * i);
-    }
+        for(std::uint64_t i = 0; i < 3; ++i) {
+            registry.destroy(entity[i]);
+            const auto entt = registry.create();
+            registry.emplace<position>(entt, 50000 * i, 50000 * i);
+        }
 
-    generic_with([&]() {
-        registry.sort<position>([](const auto &lhs, const auto &rhs) { return lhs.x > rhs.x && lhs.y > rhs.y; });
+        measure([&]() {
+            registry.sort<position>([](const auto &lhs, const auto &rhs) { return lhs.x > rhs.x && lhs.y > rhs.y; });
+        });
     });
 }
 
 TEST(Benchmark, AlmostSortedInsertionSort) {
-    entt::registry registry;
-    entt::entity entity[3]{};
+    test::benchmark(150000u, [](auto &&measure) {
+        entt::registry registry;
+        entt::entity entity[3]{};
+
+        for(std::uint64_t i = 0; i < 150000L; i++) {
+            const auto entt = registry.create();
+            registry.emplace<position>(entt, i, i);
 
-    std::cout << "Sort 150000 entities, almost sorted, insertion sort" << std::endl;
+            if(!(i % 50000)) {
+                entity[i / 50000] = entt;
+            }
+        }
 
-    for(std::uint64_t i = 0; i < 150000L; i++) {
-        const auto entt = registry.create();
-        registry.emplace<position>(entt, i, i);
+        for(std::uint64_t i = 0; i < 3; ++i) {
+            registry.destroy(entity[i]);
+            const auto entt = registry.create();
+            registry.emplace<position>(entt, 50000 * i, 50000 * i);
+        }
+
+        measure([&]() {
+            registry.sort<position>([](const auto &lhs, const auto &rhs) { return lhs.x > rhs.x && lhs.y > rhs.y; }, entt::insertion_sort{});
+        });
+    });
+}
 
-        if(!(i % 50000)) {
-            entity[i / 50000] = entt;
+struct Sweep: testing::TestWithParam<std::tuple<std::size_t, std::size_t>> {
+    void SetUp() override {
+        if(std::get<0>(GetParam()) > test::benchmark_settings().max_entities) {
+            GTEST_SKIP() << "Raise ENTT_BENCHMARK_MAX_ENTITIES to run this case";
         }
     }
+};
 
-    for(std::uint64_t i = 0; i < 3; ++i) {
-        registry.destroy(entity[i]);
-        const auto entt = registry.create();
-        registry.emplace<position>(entt, 50000 * i, 50000 * i);
-    }
+TEST_P(Sweep, CreateManyWithComponents) {
+    const auto [count, components] = GetParam();
+
+    with_components(components, [count = count](auto seq) {
+        test::benchmark(count, [&](auto &&measure) {
+            entt::registry registry;
+            std::vector<entt::entity> entity(count);
 
-    generic_with([&]() {
-        registry.sort<position>([](const auto &lhs, const auto &rhs) { return lhs.x > rhs.x && lhs.y > rhs.y; }, entt::insertion_sort{});
+            measure([&]() {
+                registry.create(entity.begin(), entity.end());
+                insert_components(registry, entity, seq);
+            });
+        });
     });
 }
+
+TEST_P(Sweep, Iterate) {
+    const auto [count, components] = GetParam();
+
+    with_components(components, [count = count](auto seq) {
+        entt::registry registry;
+        std::vector<entt::entity> entity(count);
+
+        registry.create(entity.begin(), entity.end());
+        insert_components(registry, entity, seq);
+
+        iterate_with(count, view_of(registry, seq), [](auto &...comp) {
+            ((comp.x = {}), ...);
+        });
+    });
+}
+
+TEST_P(Sweep, DestroyMany) {
+    const auto [count, components] = GetParam();
+
+    with_components(components, [count = count](auto seq) {
+        test::benchmark(count, [&](auto &&measure) {
+            entt::registry registry;
+            std::vector<entt::entity> entity(count);
+
+            registry.create(entity.begin(), entity.end());
+            insert_components(registry, entity, seq);
+
+            measure([&]() {
+                registry.destroy(entity.begin(), entity.end());
+            });
+        });
+    });
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    Benchmark,
+    Sweep,
+    testing::Combine(testing::Values(10000u, 100000u, 1000000u, 10000000u), testing::Values(1u, 2u, 3u, 5u)),
+    [](const auto &elem) { return std::to_string(std::get<0>(elem.param)) + '_' + std::to_string(std::get<1>(elem.param)); });
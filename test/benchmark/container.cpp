@@ -0,0 +1,167 @@
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <gtest/gtest.h>
+#include <entt/container/dense_map.hpp>
+#include <entt/container/dense_set.hpp>
+#include "../entt/common/tracked_memory_resource.hpp"
+#include "harness.hpp"
+
+#if defined(ENTT_HAS_TRACKED_MEMORY_RESOURCE)
+
+constexpr std::size_t count = 1000000u;
+
+using map_type = entt::dense_map<std::size_t, std::size_t, std::hash<std::size_t>, std::equal_to<std::size_t>, std::pmr::polymorphic_allocator<std::pair<const std::size_t, std::size_t>>>;
+using set_type = entt::dense_set<std::size_t, std::hash<std::size_t>, std::equal_to<std::size_t>, std::pmr::polymorphic_allocator<std::size_t>>;
+
+TEST(Benchmark, DenseMapEmplace) {
+    test::benchmark(count, [](auto &&measure) {
+        test::tracked_memory_resource resource{};
+        map_type map{&resource};
+
+        measure([&]() {
+            for(std::size_t pos{}; pos < count; ++pos) {
+                map.emplace(pos, pos);
+            }
+        });
+
+        measure.counter("allocations", static_cast<double>(resource.do_allocate_counter()));
+    });
+}
+
+TEST(Benchmark, DenseMapEmplaceReserved) {
+    test::benchmark(count, [](auto &&measure) {
+        test::tracked_memory_resource resource{};
+        map_type map{&resource};
+
+        map.reserve(count);
+        resource.reset();
+
+        measure([&]() {
+            for(std::size_t pos{}; pos < count; ++pos) {
+                map.emplace(pos, pos);
+            }
+        });
+
+        measure.counter("allocations", static_cast<double>(resource.do_allocate_counter()));
+    });
+}
+
+TEST(Benchmark, DenseMapFind) {
+    test::tracked_memory_resource resource{};
+    map_type map{&resource};
+
+    for(std::size_t pos{}; pos < count; ++pos) {
+        map.emplace(pos, pos);
+    }
+
+    test::benchmark(count, [&](auto &&measure) {
+        std::size_t sum{};
+
+        measure([&]() {
+            for(std::size_t pos{}; pos < count; ++pos) {
+                sum += map.find(pos)->second;
+            }
+        });
+
+        ASSERT_NE(sum, 0u);
+    });
+}
+
+TEST(Benchmark, DenseMapIterate) {
+    test::tracked_memory_resource resource{};
+    map_type map{&resource};
+
+    for(std::size_t pos{}; pos < count; ++pos) {
+        map.emplace(pos, pos);
+    }
+
+    test::benchmark(count, [&](auto &&measure) {
+        measure([&]() {
+            for(auto &&elem: map) {
+                elem.second = {};
+            }
+        });
+    });
+}
+
+TEST(Benchmark, DenseMapErase) {
+    test::benchmark(count, [](auto &&measure) {
+        test::tracked_memory_resource resource{};
+        map_type map{&resource};
+
+        for(std::size_t pos{}; pos < count; ++pos) {
+            map.emplace(pos, pos);
+        }
+
+        resource.reset();
+
+        measure([&]() {
+            for(std::size_t pos{}; pos < count; ++pos) {
+                map.erase(pos);
+            }
+        });
+
+        measure.counter("allocations", static_cast<double>(resource.do_allocate_counter()));
+    });
+}
+
+TEST(Benchmark, DenseSetInsert) {
+    test::benchmark(count, [](auto &&measure) {
+        test::tracked_memory_resource resource{};
+        set_type set{&resource};
+
+        measure([&]() {
+            for(std::size_t pos{}; pos < count; ++pos) {
+                set.insert(pos);
+            }
+        });
+
+        measure.counter("allocations", static_cast<double>(resource.do_allocate_counter()));
+    });
+}
+
+TEST(Benchmark, DenseSetContains) {
+    test::tracked_memory_resource resource{};
+    set_type set{&resource};
+
+    for(std::size_t pos{}; pos < count; ++pos) {
+        set.insert(pos * 2u);
+    }
+
+    test::benchmark(count * 2u, [&](auto &&measure) {
+        std::size_t found{};
+
+        measure([&]() {
+            for(std::size_t pos{}; pos < count * 2u; ++pos) {
+                found += set.contains(pos);
+            }
+        });
+
+        ASSERT_EQ(found, count);
+    });
+}
+
+TEST(Benchmark, DenseSetErase) {
+    test::benchmark(count, [](auto &&measure) {
+        test::tracked_memory_resource resource{};
+        set_type set{&resource};
+
+        for(std::size_t pos{}; pos < count; ++pos) {
+            set.insert(pos);
+        }
+
+        resource.reset();
+
+        measure([&]() {
+            for(std::size_t pos{}; pos < count; ++pos) {
+                set.erase(pos);
+            }
+        });
+
+        measure.counter("allocations", static_cast<double>(resource.do_allocate_counter()));
+    });
+}
+
+#endif
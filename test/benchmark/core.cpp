@@ -0,0 +1,71 @@
+#include <array>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/core/any.hpp>
+#include "harness.hpp"
+
+constexpr std::size_t count = 1000000u;
+
+struct large_type {
+    std::array<double, 32u> data{};
+};
+
+template<typename Type>
+void construct_with(const Type &value) {
+    test::benchmark(count, [&value](auto &&measure) {
+        std::vector<entt::any> instance{};
+        instance.reserve(count);
+
+        measure([&]() {
+            for(std::size_t pos{}; pos < count; ++pos) {
+                instance.emplace_back(value);
+            }
+        });
+    });
+}
+
+TEST(Benchmark, AnyConstructSmall) {
+    construct_with(42);
+}
+
+TEST(Benchmark, AnyConstructLarge) {
+    construct_with(large_type{});
+}
+
+TEST(Benchmark, AnyConstructString) {
+    construct_with(std::string{"a string long enough to force an allocation (hopefully)"});
+}
+
+TEST(Benchmark, AnyCopy) {
+    const entt::any source{large_type{}};
+
+    test::benchmark(count, [&source](auto &&measure) {
+        std::vector<entt::any> instance{};
+        instance.reserve(count);
+
+        measure([&]() {
+            for(std::size_t pos{}; pos < count; ++pos) {
+                instance.push_back(source);
+            }
+        });
+    });
+}
+
+TEST(Benchmark, AnyCast) {
+    std::vector<entt::any> instance(count, entt::any{42});
+
+    test::benchmark(count, [&instance](auto &&measure) {
+        int sum{};
+
+        measure([&]() {
+            for(auto &&elem: instance) {
+                sum += entt::any_cast<int>(elem);
+            }
+        });
+
+        ASSERT_EQ(sum, 42 * static_cast<int>(count));
+    });
+}
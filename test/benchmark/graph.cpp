@@ -0,0 +1,43 @@
+#include <cstddef>
+#include <iterator>
+#include <gtest/gtest.h>
+#include <entt/core/fwd.hpp>
+#include <entt/graph/flow.hpp>
+#include "harness.hpp"
+
+// tasks share a small set of resources, half of them read-only and half of them writable
+static void graph_with(const std::size_t tasks, const std::size_t resources) {
+    entt::flow builder{};
+
+    for(std::size_t pos{}; pos < tasks; ++pos) {
+        builder.bind(static_cast<entt::id_type>(pos));
+
+        for(std::size_t res{}; res < 4u; ++res) {
+            const auto id = static_cast<entt::id_type>((pos * 7u + res) % resources);
+            (res % 2u) ? builder.rw(id) : builder.ro(id);
+        }
+    }
+
+    test::benchmark(tasks, [&builder](auto &&measure) {
+        std::size_t edges{};
+
+        measure([&]() {
+            const auto graph = builder.graph();
+            edges = static_cast<std::size_t>(std::distance(graph.edges().begin(), graph.edges().end()));
+        });
+
+        ASSERT_NE(edges, 0u);
+    });
+}
+
+TEST(Benchmark, FlowGraph128) {
+    graph_with(128u, 32u);
+}
+
+TEST(Benchmark, FlowGraph256) {
+    graph_with(256u, 64u);
+}
+
+TEST(Benchmark, FlowGraph512) {
+    graph_with(512u, 128u);
+}
@@ -0,0 +1,380 @@
+#ifndef ENTT_BENCHMARK_HARNESS_HPP
+#define ENTT_BENCHMARK_HARNESS_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/config/version.h>
+#include "perf_counters.hpp"
+
+namespace test {
+
+// benchmarks are configured through environment variables so that they still run as plain tests:
+//  - ENTT_BENCHMARK_WARMUP: unmeasured runs per case (default 1)
+//  - ENTT_BENCHMARK_REPETITIONS: measured runs per case (default 5)
+//  - ENTT_BENCHMARK_MAX_ENTITIES: upper bound for the parameter sweeps (default 1M)
+//  - ENTT_BENCHMARK_FORMAT: one of text, json or csv (default text)
+//  - ENTT_BENCHMARK_OUTPUT: report file, standard output if not set
+//  - ENTT_BENCHMARK_BASELINE: report (json or csv) to compare results with
+//  - ENTT_BENCHMARK_TOLERANCE: allowed slowdown against the baseline, in percent (default 10)
+//  - ENTT_BENCHMARK_PERF: reports hardware counters per item when not zero (linux only, default 0)
+struct benchmark_config {
+    static benchmark_config from_env() {
+        benchmark_config config{};
+        config.warmup = read("ENTT_BENCHMARK_WARMUP", config.warmup);
+        config.repetitions = std::max<std::size_t>(read("ENTT_BENCHMARK_REPETITIONS", config.repetitions), 1u);
+        config.max_entities = read("ENTT_BENCHMARK_MAX_ENTITIES", config.max_entities);
+        config.tolerance = static_cast<double>(read("ENTT_BENCHMARK_TOLERANCE", static_cast<std::size_t>(config.tolerance)));
+        config.format = read("ENTT_BENCHMARK_FORMAT", config.format);
+        config.output = read("ENTT_BENCHMARK_OUTPUT", config.output);
+        config.baseline = read("ENTT_BENCHMARK_BASELINE", config.baseline);
+        config.perf = (read("ENTT_BENCHMARK_PERF", std::size_t{}) != 0u);
+        return config;
+    }
+
+    std::size_t warmup{1u};
+    std::size_t repetitions{5u};
+    std::size_t max_entities{1000000u};
+    double tolerance{10.};
+    std::string format{"text"};
+    std::string output{};
+    std::string baseline{};
+    bool perf{};
+
+private:
+    static std::size_t read(const char *name, const std::size_t value) {
+        const char *env = std::getenv(name);
+        return env ? static_cast<std::size_t>(std::strtoull(env, nullptr, 10)) : value;
+    }
+
+    static std::string read(const char *name, const std::string &value) {
+        const char *env = std::getenv(name);
+        return env ? std::string{env} : value;
+    }
+};
+
+struct benchmark_result {
+    benchmark_result(std::string id, const std::size_t count)
+        : name{std::move(id)},
+          items{count} {}
+
+    [[nodiscard]] double percentile(const double rank) const {
+        const auto pos = static_cast<std::size_t>(std::ceil(rank * static_cast<double>(samples.size())));
+        return samples[std::min(pos ? (pos - 1u) : pos, samples.size() - 1u)];
+    }
+
+    [[nodiscard]] double median() const {
+        const auto len = samples.size();
+        return (len % 2u) ? samples[len / 2u] : ((samples[len / 2u - 1u] + samples[len / 2u]) / 2.);
+    }
+
+    [[nodiscard]] double mean() const {
+        double sum{};
+        for(auto value: samples) sum += value;
+        return sum / static_cast<double>(samples.size());
+    }
+
+    [[nodiscard]] double stddev() const {
+        const auto avg = mean();
+        double sum{};
+        for(auto value: samples) sum += (value - avg) * (value - avg);
+        return std::sqrt(sum / static_cast<double>(samples.size()));
+    }
+
+    [[nodiscard]] double per_item() const {
+        return median() / static_cast<double>(std::max<std::size_t>(items, 1u));
+    }
+
+    [[nodiscard]] static double median(std::vector<double> values) {
+        std::sort(values.begin(), values.end());
+        const auto len = values.size();
+        return (len % 2u) ? values[len / 2u] : ((values[len / 2u - 1u] + values[len / 2u]) / 2.);
+    }
+
+    [[nodiscard]] double per_item(const std::vector<double> &values) const {
+        return median(values) / static_cast<double>(std::max<std::size_t>(items, 1u));
+    }
+
+    std::string name;
+    std::size_t items;
+    // nanoseconds, sorted once the case is complete
+    std::vector<double> samples{};
+    // user defined counters (allocations and so on), one value per run
+    std::vector<std::pair<std::string, std::vector<double>>> counters{};
+};
+
+class benchmark_session final: public testing::Environment {
+    using baseline_type = std::vector<std::pair<std::string, double>>;
+
+    static std::string escape(const std::string &str) {
+        std::string out{};
+
+        for(auto ch: str) {
+            if(ch == '"' || ch == '\\') {
+                out.push_back('\\');
+            }
+
+            out.push_back(ch);
+        }
+
+        return out;
+    }
+
+    static std::string field(const std::string &line, const std::string &key) {
+        const auto needle = '"' + key + "\":";
+
+        if(auto pos = line.find(needle); pos != std::string::npos) {
+            pos = line.find_first_not_of(' ', pos + needle.size());
+
+            if(line[pos] == '"') {
+                std::string value{};
+
+                for(++pos; pos < line.size() && line[pos] != '"'; ++pos) {
+                    value.push_back(line[pos] == '\\' ? line[++pos] : line[pos]);
+                }
+
+                return value;
+            }
+
+            return line.substr(pos, line.find_first_of(",}", pos) - pos);
+        }
+
+        return {};
+    }
+
+    [[nodiscard]] baseline_type load_baseline() const {
+        std::ifstream file{config.baseline};
+        baseline_type baseline{};
+        std::string line{};
+
+        if(!file) {
+            ADD_FAILURE() << "Unable to open benchmark baseline " << config.baseline;
+        } else if(std::getline(file, line) && line.rfind("name,", 0u) == 0u) {
+            // name,items,repetitions,min_ns,median_ns,p10_ns,p90_ns,max_ns,mean_ns,stddev_ns,ns_per_item,counters
+            while(std::getline(file, line)) {
+                std::size_t pos = line.find(',');
+                const auto name = line.substr(0u, pos);
+
+                for(auto column = 1u; column < 10u && pos != std::string::npos; ++column) {
+                    pos = line.find(',', pos + 1u);
+                }
+
+                if(pos != std::string::npos) {
+                    baseline.emplace_back(name.size() > 1u && name.front() == '"' ? name.substr(1u, name.size() - 2u) : name, std::strtod(line.c_str() + pos + 1u, nullptr));
+                }
+            }
+        } else {
+            do {
+                if(auto name = field(line, "name"); !name.empty()) {
+                    baseline.emplace_back(std::move(name), std::strtod(field(line, "ns_per_item").c_str(), nullptr));
+                }
+            } while(std::getline(file, line));
+        }
+
+        return baseline;
+    }
+
+    void write_json(std::ostream &out) const {
+        out << std::fixed << std::setprecision(3) << "{\n    \"version\": \"" << ENTT_VERSION << "\",\n    \"results\": [\n";
+
+        for(std::size_t pos{}, last = results.size(); pos < last; ++pos) {
+            const auto &elem = results[pos];
+            out << "        {\"name\": \"" << escape(elem.name) << "\", \"items\": " << elem.items << ", \"repetitions\": " << elem.samples.size()
+                << ", \"min_ns\": " << elem.samples.front() << ", \"median_ns\": " << elem.median() << ", \"p10_ns\": " << elem.percentile(.1)
+                << ", \"p90_ns\": " << elem.percentile(.9) << ", \"max_ns\": " << elem.samples.back() << ", \"mean_ns\": " << elem.mean()
+                << ", \"stddev_ns\": " << elem.stddev() << ", \"ns_per_item\": " << elem.per_item() << ", \"counters\": {";
+
+            for(std::size_t next{}; next < elem.counters.size(); ++next) {
+                out << (next ? ", \"" : "\"") << escape(elem.counters[next].first) << "\": " << elem.per_item(elem.counters[next].second);
+            }
+
+            out << "}}" << (pos + 1u == last ? "\n" : ",\n");
+        }
+
+        out << "    ]\n}\n";
+    }
+
+    void write_csv(std::ostream &out) const {
+        out << std::fixed << std::setprecision(3) << "name,items,repetitions,min_ns,median_ns,p10_ns,p90_ns,max_ns,mean_ns,stddev_ns,ns_per_item,counters\n";
+
+        for(const auto &elem: results) {
+            out << '"' << elem.name << "\"," << elem.items << ',' << elem.samples.size() << ',' << elem.samples.front() << ',' << elem.median() << ','
+                << elem.percentile(.1) << ',' << elem.percentile(.9) << ',' << elem.samples.back() << ',' << elem.mean() << ',' << elem.stddev() << ','
+                << elem.per_item() << ',';
+
+            for(std::size_t next{}; next < elem.counters.size(); ++next) {
+                out << (next ? ";" : "") << elem.counters[next].first << '=' << elem.per_item(elem.counters[next].second);
+            }
+
+            out << '\n';
+        }
+    }
+
+    void compare() const {
+        const auto baseline = load_baseline();
+        std::ostringstream out{};
+        out << std::fixed << std::setprecision(3) << "Comparison against " << config.baseline << " (tolerance " << config.tolerance << "%)\n";
+
+        for(const auto &elem: results) {
+            const auto it = std::find_if(baseline.cbegin(), baseline.cend(), [&elem](const auto &curr) { return curr.first == elem.name; });
+
+            if(it != baseline.cend() && it->second > 0.) {
+                const auto delta = (elem.per_item() - it->second) / it->second * 100.;
+                out << "  " << elem.name << ": " << it->second << " -> " << elem.per_item() << " ns/item (" << std::showpos << delta << std::noshowpos << "%)\n";
+                EXPECT_LE(delta, config.tolerance) << elem.name << " regressed against the baseline";
+            } else {
+                out << "  " << elem.name << ": no baseline\n";
+            }
+        }
+
+        std::cout << out.str() << std::flush;
+    }
+
+    benchmark_session()
+        : config{benchmark_config::from_env()},
+          hardware{config.perf} {
+        if(config.perf && hardware.empty()) {
+            std::cout << "Hardware counters not available, only time is measured" << std::endl;
+        }
+    }
+
+public:
+    static benchmark_session &instance() {
+        // ownership is transferred to googletest, that also tears it down
+        static auto *session = static_cast<benchmark_session *>(testing::AddGlobalTestEnvironment(new benchmark_session{}));
+        return *session;
+    }
+
+    [[nodiscard]] const benchmark_config &settings() const noexcept {
+        return config;
+    }
+
+    [[nodiscard]] perf_counters &counters() noexcept {
+        return hardware;
+    }
+
+    const benchmark_result &record(benchmark_result result) {
+        std::sort(result.samples.begin(), result.samples.end());
+
+        std::ostringstream out{};
+        out << std::fixed << std::setprecision(3) << result.name << ": " << result.items << " items, median " << (result.median() / 1e6) << " ms"
+            << " [p10 " << (result.percentile(.1) / 1e6) << ", p90 " << (result.percentile(.9) / 1e6) << "], " << result.per_item() << " ns/item";
+
+        for(const auto &[id, values]: result.counters) {
+            out << ", " << id << ' ' << std::defaultfloat << std::setprecision(4) << result.per_item(values) << std::fixed << std::setprecision(3) << "/item";
+        }
+
+        std::cout << out.str() << std::endl;
+        return results.emplace_back(std::move(result));
+    }
+
+    void TearDown() override {
+        if(config.format == "json" || config.format == "csv") {
+            std::ofstream file{};
+
+            if(!config.output.empty()) {
+                file.open(config.output);
+            }
+
+            std::ostream &out = file.is_open() ? file : std::cout;
+            (config.format == "json") ? write_json(out) : write_csv(out);
+        }
+
+        if(!config.baseline.empty()) {
+            compare();
+        }
+    }
+
+private:
+    benchmark_config config;
+    perf_counters hardware;
+    std::vector<benchmark_result> results;
+};
+
+// registers the session before running the tests
+inline benchmark_session &benchmark_session_instance = benchmark_session::instance();
+
+class benchmark_timer final {
+public:
+    benchmark_timer(perf_counters &counters)
+        : hardware{&counters} {}
+
+    template<typename Func>
+    void operator()(Func &&func) {
+        hardware->start();
+        const auto start = std::chrono::steady_clock::now();
+        std::forward<Func>(func)();
+        elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        hardware->stop();
+
+        hardware->each([this](const char *name, const double value) { counter(name, value); });
+    }
+
+    // attaches a value to the current run, reported per item along with the time
+    void counter(std::string name, const double value) {
+        values.emplace_back(std::move(name), value);
+    }
+
+    [[nodiscard]] double value() const noexcept {
+        return elapsed;
+    }
+
+    [[nodiscard]] const std::vector<std::pair<std::string, double>> &counters() const noexcept {
+        return values;
+    }
+
+private:
+    perf_counters *hardware;
+    double elapsed{};
+    std::vector<std::pair<std::string, double>> values{};
+};
+
+[[nodiscard]] inline const benchmark_config &benchmark_settings() {
+    return benchmark_session::instance().settings();
+}
+
+// runs a case multiple times and records its statistics, the function object
+// receives a timer and invokes it exactly once with the code to measure so that
+// setup and teardown of each run are left out of the measurements
+template<typename Func>
+const benchmark_result &benchmark(std::string name, const std::size_t items, Func func) {
+    const auto &config = benchmark_settings();
+    benchmark_result result{std::move(name), items};
+
+    for(std::size_t run{}, last = config.warmup + config.repetitions; run < last; ++run) {
+        benchmark_timer timer{benchmark_session::instance().counters()};
+        func(timer);
+
+        if(!(run < config.warmup)) {
+            result.samples.push_back(timer.value());
+
+            for(auto &&[id, value]: timer.counters()) {
+                auto it = std::find_if(result.counters.begin(), result.counters.end(), [&id = id](const auto &curr) { return curr.first == id; });
+                (it == result.counters.end() ? result.counters.emplace_back(id, std::vector<double>{}).second : it->second).push_back(value);
+            }
+        }
+    }
+
+    return benchmark_session::instance().record(std::move(result));
+}
+
+// the name of the case is that of the running test
+template<typename Func>
+const benchmark_result &benchmark(const std::size_t items, Func func) {
+    const auto *info = testing::UnitTest::GetInstance()->current_test_info();
+    return benchmark(std::string{info->test_suite_name()} + '.' + info->name(), items, std::move(func));
+}
+
+} // namespace test
+
+#endif
@@ -0,0 +1,124 @@
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <entt/core/hashed_string.hpp>
+#include <entt/meta/factory.hpp>
+#include <entt/meta/meta.hpp>
+#include <entt/meta/resolve.hpp>
+#include "harness.hpp"
+
+constexpr std::size_t count = 1000000u;
+
+struct base {
+    void set(int value) {
+        data = value;
+    }
+
+    [[nodiscard]] int get() const {
+        return data;
+    }
+
+    int data{};
+};
+
+struct derived: base {
+    [[nodiscard]] int twice(int value) const {
+        return value * 2;
+    }
+};
+
+struct Meta: ::testing::Test {
+    void SetUp() override {
+        using namespace entt::literals;
+
+        entt::meta<base>()
+            .type("base"_hs)
+            .func<&base::set>("set"_hs)
+            .func<&base::get>("get"_hs);
+
+        entt::meta<derived>()
+            .type("derived"_hs)
+            .base<base>()
+            .func<&derived::twice>("twice"_hs);
+    }
+
+    void TearDown() override {
+        entt::meta_reset();
+    }
+};
+
+TEST_F(Meta, ResolveById) {
+    using namespace entt::literals;
+
+    test::benchmark(count, [](auto &&measure) {
+        std::size_t found{};
+
+        measure([&]() {
+            for(std::size_t pos{}; pos < count; ++pos) {
+                found += static_cast<bool>(entt::resolve("derived"_hs));
+            }
+        });
+
+        ASSERT_EQ(found, count);
+    });
+}
+
+TEST_F(Meta, ResolveByType) {
+    test::benchmark(count, [](auto &&measure) {
+        std::size_t found{};
+
+        measure([&]() {
+            for(std::size_t pos{}; pos < count; ++pos) {
+                found += static_cast<bool>(entt::resolve<derived>());
+            }
+        });
+
+        ASSERT_EQ(found, count);
+    });
+}
+
+TEST_F(Meta, Invoke) {
+    using namespace entt::literals;
+
+    const auto type = entt::resolve<derived>();
+    derived instance{};
+
+    test::benchmark(count, [&](auto &&measure) {
+        measure([&]() {
+            for(std::size_t pos{}; pos < count; ++pos) {
+                type.invoke("twice"_hs, instance, static_cast<int>(pos));
+            }
+        });
+    });
+}
+
+TEST_F(Meta, InvokeFromBase) {
+    using namespace entt::literals;
+
+    const auto type = entt::resolve<derived>();
+    derived instance{};
+
+    test::benchmark(count, [&](auto &&measure) {
+        measure([&]() {
+            for(std::size_t pos{}; pos < count; ++pos) {
+                type.invoke("set"_hs, instance, static_cast<int>(pos));
+            }
+        });
+
+        ASSERT_EQ(instance.get(), static_cast<int>(count - 1u));
+    });
+}
+
+TEST_F(Meta, InvokeCachedFunc) {
+    using namespace entt::literals;
+
+    const auto func = entt::resolve<derived>().func("twice"_hs);
+    derived instance{};
+
+    test::benchmark(count, [&](auto &&measure) {
+        measure([&]() {
+            for(std::size_t pos{}; pos < count; ++pos) {
+                func.invoke(instance, static_cast<int>(pos));
+            }
+        });
+    });
+}
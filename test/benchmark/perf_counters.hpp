@@ -0,0 +1,118 @@
+#ifndef ENTT_BENCHMARK_PERF_COUNTERS_HPP
+#define ENTT_BENCHMARK_PERF_COUNTERS_HPP
+
+#include <cstdint>
+#include <vector>
+
+#if defined(__linux__)
+#    include <cstring>
+#    include <linux/perf_event.h>
+#    include <sys/ioctl.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#endif
+
+namespace test {
+
+// hardware counters read through perf_event_open on linux, events that cannot be
+// opened (containers, virtual machines, restrictive perf_event_paranoid and so on)
+// are silently skipped and the whole thing turns into a no-op elsewhere
+class perf_counters {
+    struct event {
+        const char *name;
+        int fd;
+    };
+
+#if defined(__linux__)
+    static constexpr std::uint64_t cache_miss(const std::uint64_t cache) noexcept {
+        return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8u) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16u);
+    }
+
+    void open(const char *name, const std::uint32_t type, const std::uint64_t config) {
+        perf_event_attr attr{};
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = type;
+        attr.config = config;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+        if(const auto fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0)); fd != -1) {
+            events.push_back({name, fd});
+        }
+    }
+#endif
+
+public:
+    perf_counters() = default;
+
+    explicit perf_counters([[maybe_unused]] const bool enable) {
+#if defined(__linux__)
+        if(enable) {
+            open("cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+            open("instructions", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+            open("branch_misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+            open("l1d_misses", PERF_TYPE_HW_CACHE, cache_miss(PERF_COUNT_HW_CACHE_L1D));
+            open("llc_misses", PERF_TYPE_HW_CACHE, cache_miss(PERF_COUNT_HW_CACHE_LL));
+            open("dtlb_misses", PERF_TYPE_HW_CACHE, cache_miss(PERF_COUNT_HW_CACHE_DTLB));
+        }
+#endif
+    }
+
+    perf_counters(const perf_counters &) = delete;
+    perf_counters &operator=(const perf_counters &) = delete;
+
+    ~perf_counters() {
+#if defined(__linux__)
+        for(auto &&elem: events) {
+            close(elem.fd);
+        }
+#endif
+    }
+
+    [[nodiscard]] bool empty() const noexcept {
+        return events.empty();
+    }
+
+    void start() {
+#if defined(__linux__)
+        for(auto &&elem: events) {
+            ioctl(elem.fd, PERF_EVENT_IOC_RESET, 0);
+            ioctl(elem.fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif
+    }
+
+    void stop() {
+#if defined(__linux__)
+        for(auto &&elem: events) {
+            ioctl(elem.fd, PERF_EVENT_IOC_DISABLE, 0);
+        }
+#endif
+    }
+
+    // invokes the function with the name and value of all counters, values are
+    // scaled when the kernel multiplexes more events than available registers
+    template<typename Func>
+    void each([[maybe_unused]] Func func) const {
+#if defined(__linux__)
+        for(auto &&elem: events) {
+            // value, time enabled, time running
+            std::uint64_t data[3u]{};
+
+            if(read(elem.fd, data, sizeof(data)) == static_cast<ssize_t>(sizeof(data)) && data[2u] != 0u) {
+                func(elem.name, static_cast<double>(data[0u]) * static_cast<double>(data[1u]) / static_cast<double>(data[2u]));
+            }
+        }
+#endif
+    }
+
+private:
+    std::vector<event> events{};
+};
+
+} // namespace test
+
+#endif
@@ -0,0 +1,80 @@
+#include <cstddef>
+#include <memory>
+#include <gtest/gtest.h>
+#include <entt/core/fwd.hpp>
+#include <entt/resource/cache.hpp>
+#include <entt/resource/loader.hpp>
+#include "../entt/common/tracked_memory_resource.hpp"
+#include "harness.hpp"
+
+constexpr std::size_t count = 100000u;
+
+struct resource_type {
+    resource_type(const std::size_t id)
+        : value{id} {}
+
+    std::size_t value{};
+};
+
+#if defined(ENTT_HAS_TRACKED_MEMORY_RESOURCE)
+
+using cache_type = entt::resource_cache<resource_type, entt::resource_loader<resource_type>, std::pmr::polymorphic_allocator<resource_type>>;
+
+TEST(Benchmark, ResourceCacheLoad) {
+    test::benchmark(count, [](auto &&measure) {
+        test::tracked_memory_resource resource{};
+        cache_type cache{&resource};
+
+        measure([&]() {
+            for(std::size_t pos{}; pos < count; ++pos) {
+                cache.load(static_cast<entt::id_type>(pos), pos);
+            }
+        });
+
+        measure.counter("allocations", static_cast<double>(resource.do_allocate_counter()));
+    });
+}
+
+TEST(Benchmark, ResourceCacheLoadExisting) {
+    test::tracked_memory_resource resource{};
+    cache_type cache{&resource};
+
+    for(std::size_t pos{}; pos < count; ++pos) {
+        cache.load(static_cast<entt::id_type>(pos), pos);
+    }
+
+    test::benchmark(count, [&](auto &&measure) {
+        resource.reset();
+
+        measure([&]() {
+            for(std::size_t pos{}; pos < count; ++pos) {
+                cache.load(static_cast<entt::id_type>(pos), pos);
+            }
+        });
+
+        measure.counter("allocations", static_cast<double>(resource.do_allocate_counter()));
+    });
+}
+
+TEST(Benchmark, ResourceCacheLookup) {
+    test::tracked_memory_resource resource{};
+    cache_type cache{&resource};
+
+    for(std::size_t pos{}; pos < count; ++pos) {
+        cache.load(static_cast<entt::id_type>(pos), pos);
+    }
+
+    test::benchmark(count, [&](auto &&measure) {
+        std::size_t sum{};
+
+        measure([&]() {
+            for(std::size_t pos{}; pos < count; ++pos) {
+                sum += cache[static_cast<entt::id_type>(pos)]->value;
+            }
+        });
+
+        ASSERT_NE(sum, 0u);
+    });
+}
+
+#endif
@@ -0,0 +1,118 @@
+#include <cstddef>
+#include <memory>
+#include <gtest/gtest.h>
+#include <entt/signal/dispatcher.hpp>
+#include <entt/signal/emitter.hpp>
+#include <entt/signal/sigh.hpp>
+#include "../entt/common/tracked_memory_resource.hpp"
+#include "harness.hpp"
+
+constexpr std::size_t count = 1000000u;
+constexpr std::size_t listeners = 16u;
+
+struct event {
+    std::size_t value{};
+};
+
+struct listener {
+    void receive(const event &elem) {
+        sum += elem.value;
+    }
+
+    void on_value(std::size_t value) {
+        sum += value;
+    }
+
+    std::size_t sum{};
+};
+
+TEST(Benchmark, SighPublish) {
+    entt::sigh<void(std::size_t)> sigh{};
+    entt::sink sink{sigh};
+    listener instance[listeners]{};
+
+    for(auto &&elem: instance) {
+        sink.connect<&listener::on_value>(elem);
+    }
+
+    test::benchmark(count * listeners, [&](auto &&measure) {
+        measure([&]() {
+            for(std::size_t pos{}; pos < count; ++pos) {
+                sigh.publish(pos);
+            }
+        });
+    });
+}
+
+TEST(Benchmark, DispatcherTrigger) {
+    entt::dispatcher dispatcher{};
+    listener instance{};
+
+    dispatcher.sink<event>().connect<&listener::receive>(instance);
+
+    test::benchmark(count, [&](auto &&measure) {
+        measure([&]() {
+            for(std::size_t pos{}; pos < count; ++pos) {
+                dispatcher.trigger(event{pos});
+            }
+        });
+    });
+}
+
+TEST(Benchmark, DispatcherEnqueueAndUpdate) {
+    entt::dispatcher dispatcher{};
+    listener instance{};
+
+    dispatcher.sink<event>().connect<&listener::receive>(instance);
+
+    test::benchmark(count, [&](auto &&measure) {
+        measure([&]() {
+            for(std::size_t pos{}; pos < count; ++pos) {
+                dispatcher.enqueue<event>(pos);
+            }
+
+            dispatcher.update<event>();
+        });
+    });
+}
+
+struct test_emitter: entt::emitter<test_emitter> {};
+
+TEST(Benchmark, EmitterPublish) {
+    test_emitter emitter{};
+    std::size_t sum{};
+
+    emitter.on<event>([&sum](const event &elem, test_emitter &) { sum += elem.value; });
+
+    test::benchmark(count, [&](auto &&measure) {
+        measure([&]() {
+            for(std::size_t pos{}; pos < count; ++pos) {
+                emitter.publish(event{pos});
+            }
+        });
+    });
+}
+
+#if defined(ENTT_HAS_TRACKED_MEMORY_RESOURCE)
+
+TEST(Benchmark, SighConnectAllocations) {
+    // connecting is linear in the number of listeners, keep the count reasonable
+    constexpr std::size_t connections = 10000u;
+
+    test::benchmark(connections, [](auto &&measure) {
+        test::tracked_memory_resource resource{};
+        entt::sigh<void(std::size_t), std::pmr::polymorphic_allocator<void>> sigh{&resource};
+        entt::sink sink{sigh};
+        std::unique_ptr<listener[]> instance{new listener[connections]{}};
+
+        measure([&]() {
+            for(std::size_t pos{}; pos < connections; ++pos) {
+                sink.template connect<&listener::on_value>(instance[pos]);
+            }
+        });
+
+        measure.counter("allocations", static_cast<double>(resource.do_allocate_counter()));
+    });
+}
+
+#endif
@@ -0,0 +1,146 @@
+#define ENTT_TRACING
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <gtest/gtest.h>
+#include <entt/core/trace.hpp>
+#include <entt/core/type_info.hpp>
+#include <entt/entity/organizer.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/snapshot.hpp>
+#include <entt/process/scheduler.hpp>
+#include <entt/signal/dispatcher.hpp>
+
+struct event {};
+
+void ro_system(entt::view<entt::get_t<int>>) {}
+
+struct output_archive {
+    template<typename Type>
+    void operator()(const Type &) {}
+};
+
+struct Trace: ::testing::Test {
+    void SetUp() override {
+        entt::trace_clear();
+    }
+
+    static std::size_t count(const std::string_view category) {
+        std::size_t result{};
+
+        entt::trace_each([&](const std::size_t, const entt::trace_event &elem) {
+            result += (elem.category == category);
+        });
+
+        return result;
+    }
+};
+
+TEST_F(Trace, Scope) {
+    {
+        ENTT_TRACE_SCOPE("test", "outer");
+        ENTT_TRACE_SCOPE("test", "inner");
+    }
+
+    std::size_t visited{};
+
+    entt::trace_each([&](const std::size_t, const entt::trace_event &elem) {
+        ASSERT_EQ(elem.category, "test");
+        // inner scopes are closed and therefore recorded first
+        ASSERT_EQ(elem.name, visited++ ? "outer" : "inner");
+    });
+
+    ASSERT_EQ(visited, 2u);
+
+    entt::trace_clear();
+
+    ASSERT_EQ(count("test"), 0u);
+}
+
+TEST_F(Trace, Threads) {
+    std::thread worker{[]() { ENTT_TRACE_SCOPE("test", "worker"); }};
+    worker.join();
+
+    {
+        ENTT_TRACE_SCOPE("test", "main");
+    }
+
+    std::size_t thread[2u]{};
+
+    entt::trace_each([&](const std::size_t curr, const entt::trace_event &elem) {
+        thread[elem.name == "main"] = curr;
+    });
+
+    ASSERT_EQ(count("test"), 2u);
+    ASSERT_NE(thread[0u], thread[1u]);
+}
+
+TEST_F(Trace, Overflow) {
+    for(std::size_t pos{}; pos < ENTT_TRACE_BUFFER + 1u; ++pos) {
+        ENTT_TRACE_SCOPE("test", "overflow");
+    }
+
+    // the slot in front of the head is never visited
+    ASSERT_EQ(count("test"), ENTT_TRACE_BUFFER - 1u);
+}
+
+TEST_F(Trace, Json) {
+    {
+        ENTT_TRACE_SCOPE("test", "\"quoted\"");
+    }
+
+    const auto json = entt::trace_to_json();
+
+    ASSERT_EQ(json.find("{\"traceEvents\":[{\"cat\":\"test\",\"name\":\"\\\"quoted\\\"\",\"ph\":\"X\",\"pid\":0,\"tid\":"), 0u);
+    ASSERT_EQ(json.substr(json.size() - 3u), "}]}");
+
+    entt::trace_clear();
+
+    ASSERT_EQ(entt::trace_to_json(), "{\"traceEvents\":[]}");
+}
+
+TEST_F(Trace, Library) {
+    entt::registry registry{};
+    entt::dispatcher dispatcher{};
+
+    registry.emplace<int>(registry.create());
+    registry.sort<int>([](auto lhs, auto rhs) { return lhs < rhs; });
+    registry.clear<int>();
+
+    dispatcher.enqueue<event>();
+    dispatcher.update<event>();
+
+    ASSERT_EQ(count("sort"), 1u);
+    ASSERT_EQ(count("clear"), 1u);
+    ASSERT_EQ(count("dispatcher"), 1u);
+
+    entt::trace_each([](const std::size_t, const entt::trace_event &elem) {
+        if(elem.category == "dispatcher") {
+            ASSERT_EQ(elem.name, entt::type_name<event>::value());
+        } else {
+            ASSERT_EQ(elem.name, entt::type_name<int>::value());
+        }
+    });
+
+    entt::organizer organizer{};
+    entt::scheduler scheduler{};
+    output_archive archive{};
+
+    organizer.emplace<&ro_system>("ro_system");
+
+    for(auto &&vertex: organizer.graph()) {
+        vertex.callback()(vertex.data(), registry);
+    }
+
+    scheduler.attach([](auto, void *, auto succeed, auto) { succeed(); });
+    scheduler.update(0u);
+
+    entt::snapshot{registry}.get<int>(archive);
+
+    ASSERT_EQ(count("organizer"), 1u);
+    // attaching a process also forces it to exit the uninitialized state
+    ASSERT_EQ(count("scheduler"), 2u);
+    ASSERT_EQ(count("snapshot"), 1u);
+}
@@ -0,0 +1,130 @@
+#include <gtest/gtest.h>
+#include <entt/core/type_info.hpp>
+#include <entt/entity/access_tracker.hpp>
+#include <entt/entity/organizer.hpp>
+#include <entt/entity/registry.hpp>
+#include "../common/config.h"
+
+void ro_int(entt::view<entt::get_t<const int>>) {}
+void rw_int(entt::view<entt::get_t<int>>) {}
+void ro_int_rw_char(entt::view<entt::get_t<const int, char>>, entt::view<entt::get_t<const char>>) {}
+void ro_char(entt::view<entt::get_t<const char>>) {}
+void ro_int_rw_ctx(entt::view<entt::get_t<const int>>, double &) {}
+void ro_ctx(const double &) {}
+
+TEST(AccessTracker, Functionalities) {
+    entt::registry registry;
+    registry.storage<int>();
+
+    entt::access_tracker tracker{registry};
+
+    ASSERT_EQ(tracker.size(), 2u);
+    ASSERT_TRUE(tracker.contains(entt::type_hash<entt::entity>::value()));
+    ASSERT_TRUE(tracker.contains(entt::type_hash<int>::value()));
+    ASSERT_FALSE(tracker.contains(entt::type_hash<char>::value()));
+
+    const auto id = entt::type_hash<int>::value();
+
+    ASSERT_TRUE(tracker.try_read(id));
+    ASSERT_TRUE(tracker.try_read(id));
+    ASSERT_FALSE(tracker.try_write(id));
+
+    tracker.release_read(id);
+
+    ASSERT_FALSE(tracker.try_write(id));
+
+    tracker.release_read(id);
+
+    ASSERT_TRUE(tracker.try_write(id));
+    ASSERT_FALSE(tracker.try_write(id));
+    ASSERT_FALSE(tracker.try_read(id));
+
+    tracker.release_write(id);
+
+    ASSERT_TRUE(tracker.try_read(id));
+
+    tracker.release_read(id);
+}
+
+TEST(AccessTracker, Organizer) {
+    entt::organizer organizer;
+    entt::registry registry;
+
+    organizer.emplace<&ro_int>("t1");
+    organizer.emplace<&rw_int>("t2");
+    organizer.emplace<&ro_int_rw_char>("t3");
+    organizer.emplace<&ro_char>("t4");
+
+    const auto graph = organizer.graph();
+
+    for(auto &&vertex: graph) {
+        vertex.prepare(registry);
+    }
+
+    registry.freeze();
+    entt::access_tracker tracker{registry, graph};
+
+    ASSERT_TRUE(tracker.try_acquire(0u));
+    ASSERT_FALSE(tracker.try_acquire(1u));
+    // char is both read and written and therefore borrowed for writing
+    ASSERT_TRUE(tracker.try_acquire(2u));
+    ASSERT_FALSE(tracker.try_acquire(3u));
+
+    tracker.release(2u);
+
+    ASSERT_TRUE(tracker.try_acquire(3u));
+    // failed requests don't leave pools borrowed
+    ASSERT_FALSE(tracker.try_acquire(2u));
+
+    tracker.release(0u);
+    tracker.release(3u);
+
+    ASSERT_TRUE(tracker.try_acquire(1u));
+    ASSERT_FALSE(tracker.try_acquire(0u));
+
+    tracker.release(1u);
+
+    ASSERT_TRUE(tracker.try_acquire(2u));
+
+    tracker.release(2u);
+}
+
+TEST(AccessTracker, ContextVariables) {
+    entt::organizer organizer;
+    entt::registry registry;
+
+    organizer.emplace<&ro_int_rw_ctx>("t1");
+    organizer.emplace<&ro_ctx>("t2");
+    organizer.emplace<&ro_int>("t3");
+
+    const auto graph = organizer.graph();
+
+    for(auto &&vertex: graph) {
+        vertex.prepare(registry);
+    }
+
+    registry.freeze();
+    entt::access_tracker tracker{registry, graph};
+
+    // context variables aren't pools but are tracked anyway
+    ASSERT_FALSE(registry.storage(entt::type_hash<double>::value()));
+    ASSERT_TRUE(tracker.contains(entt::type_hash<double>::value()));
+
+    ASSERT_TRUE(tracker.try_acquire(0u));
+    ASSERT_FALSE(tracker.try_acquire(1u));
+    ASSERT_TRUE(tracker.try_acquire(2u));
+
+    tracker.release(0u);
+
+    ASSERT_TRUE(tracker.try_acquire(1u));
+
+    tracker.release(1u);
+    tracker.release(2u);
+}
+
+ENTT_DEBUG_TEST(AccessTrackerDeathTest, Untracked) {
+    entt::registry registry;
+    entt::access_tracker tracker{registry};
+
+    ASSERT_DEATH([[maybe_unused]] const bool result = tracker.try_read(entt::type_hash<int>::value()), "");
+}
@@ -0,0 +1,150 @@
+#include <cstddef>
+#include <functional>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/core/hashed_string.hpp>
+#include <entt/core/type_info.hpp>
+#include <entt/entity/diff.hpp>
+#include <entt/entity/entity.hpp>
+#include <entt/entity/registry.hpp>
+
+struct empty_type {};
+
+struct stable_type {
+    static constexpr auto in_place_delete = true;
+    int value;
+};
+
+struct approx_type {
+    float value;
+};
+
+struct record {
+    entt::id_type id;
+    entt::entity entity;
+    entt::difference kind;
+};
+
+TEST(RegistryDiff, Entities) {
+    using traits_type = entt::entt_traits<entt::entity>;
+
+    entt::registry lhs;
+    entt::registry rhs;
+    std::vector<record> result{};
+
+    ASSERT_EQ(lhs.create(entt::entity{0}), entt::entity{0});
+    ASSERT_EQ(rhs.create(entt::entity{0}), entt::entity{0});
+    ASSERT_EQ(lhs.create(entt::entity{1}), entt::entity{1});
+    ASSERT_EQ(rhs.create(entt::entity{2}), entt::entity{2});
+
+    entt::registry_diff{lhs, lhs}.entities([&](auto entt, auto kind) { result.push_back({0u, entt, kind}); });
+
+    ASSERT_TRUE(result.empty());
+
+    entt::registry_diff{lhs, rhs}.entities([&](auto entt, auto kind) { result.push_back({0u, entt, kind}); });
+
+    ASSERT_EQ(result.size(), 2u);
+    ASSERT_EQ(result[0u].entity, entt::entity{1});
+    ASSERT_EQ(result[0u].kind, entt::difference::lhs_only);
+    ASSERT_EQ(result[1u].entity, entt::entity{2});
+    ASSERT_EQ(result[1u].kind, entt::difference::rhs_only);
+
+    result.clear();
+    rhs.destroy(entt::entity{0});
+
+    ASSERT_EQ(rhs.create(traits_type::construct(0u, 1u)), traits_type::construct(0u, 1u));
+
+    entt::registry_diff{lhs, rhs}.entities([&](auto entt, auto kind) { result.push_back({0u, entt, kind}); });
+
+    // versions are part of the comparison
+    ASSERT_EQ(result.size(), 4u);
+}
+
+TEST(RegistryDiff, Storage) {
+    entt::registry lhs;
+    entt::registry rhs;
+    std::vector<record> result{};
+
+    const auto entity = lhs.create();
+    const auto other = lhs.create();
+
+    ASSERT_EQ(rhs.create(entity), entity);
+    ASSERT_EQ(rhs.create(other), other);
+
+    lhs.emplace<int>(entity, 1);
+    rhs.emplace<int>(entity, 2);
+    lhs.emplace<empty_type>(other);
+    rhs.emplace<char>(other);
+
+    entt::registry_diff{lhs, rhs}.storage([&](auto id, auto entt, auto kind) { result.push_back({id, entt, kind}); });
+
+    // values are ignored, pools are matched by name
+    ASSERT_EQ(result.size(), 2u);
+    ASSERT_EQ(result[0u].id, entt::type_id<empty_type>().hash());
+    ASSERT_EQ(result[0u].entity, other);
+    ASSERT_EQ(result[0u].kind, entt::difference::lhs_only);
+    ASSERT_EQ(result[1u].id, entt::type_id<char>().hash());
+    ASSERT_EQ(result[1u].entity, other);
+    ASSERT_EQ(result[1u].kind, entt::difference::rhs_only);
+}
+
+TEST(RegistryDiff, Get) {
+    using namespace entt::literals;
+
+    entt::registry lhs;
+    entt::registry rhs;
+    std::vector<record> result{};
+    const auto func = [&](auto entt, auto kind) { result.push_back({0u, entt, kind}); };
+
+    for(std::size_t pos{}; pos < ENTT_PACKED_PAGE * 2u; ++pos) {
+        const auto entity = lhs.create();
+
+        ASSERT_EQ(rhs.create(entity), entity);
+
+        lhs.emplace<int>(entity, static_cast<int>(pos));
+        rhs.emplace<int>(entity, static_cast<int>(pos));
+    }
+
+    entt::registry_diff{lhs, rhs}.get<int>(func).get<empty_type>(func).get<int>(func, std::equal_to<int>{}, "other"_hs);
+
+    ASSERT_TRUE(result.empty());
+
+    const auto entity = entt::entity{ENTT_PACKED_PAGE + 3u};
+    rhs.get<int>(entity) = -1;
+    rhs.erase<int>(entt::entity{0});
+
+    entt::registry_diff{lhs, rhs}.get<int>(func);
+
+    ASSERT_EQ(result.size(), 2u);
+    ASSERT_EQ(result[0u].entity, entt::entity{0});
+    ASSERT_EQ(result[0u].kind, entt::difference::lhs_only);
+    ASSERT_EQ(result[1u].entity, entity);
+    ASSERT_EQ(result[1u].kind, entt::difference::value);
+}
+
+TEST(RegistryDiff, GetWithComparator) {
+    entt::registry lhs;
+    entt::registry rhs;
+    std::vector<record> result{};
+    const auto func = [&](auto entt, auto kind) { result.push_back({0u, entt, kind}); };
+    const auto compare = [](const approx_type &elem, const approx_type &other) { return (elem.value - other.value) < .1f && (other.value - elem.value) < .1f; };
+
+    const auto entity = lhs.create();
+
+    ASSERT_EQ(rhs.create(entity), entity);
+
+    lhs.emplace<approx_type>(entity, 1.f);
+    rhs.emplace<approx_type>(entity, 1.01f);
+    lhs.emplace<stable_type>(entity, 1);
+    rhs.emplace<stable_type>(entity, 2);
+
+    entt::registry_diff{lhs, rhs}.get<approx_type>(func, compare);
+
+    ASSERT_TRUE(result.empty());
+
+    entt::registry_diff{lhs, rhs}.get<stable_type>(func, [](const auto &elem, const auto &other) { return elem.value == other.value; });
+
+    ASSERT_EQ(result.size(), 1u);
+    ASSERT_EQ(result[0u].entity, entity);
+    ASSERT_EQ(result[0u].kind, entt::difference::value);
+}
@@ -0,0 +1,124 @@
+#include <cstddef>
+#include <functional>
+#include <gtest/gtest.h>
+#include <entt/config/config.h>
+#include <entt/entity/double_buffer.hpp>
+#include <entt/entity/entity.hpp>
+#include <entt/entity/registry.hpp>
+
+struct empty_type {};
+
+struct transform {
+    int x;
+    int y;
+};
+
+struct no_default_type {
+    no_default_type(int elem)
+        : value{elem} {}
+
+    int value;
+};
+
+TEST(DoubleBuffer, Functionalities) {
+    entt::registry registry;
+    entt::double_buffer<transform> buffer{registry.storage<transform>()};
+
+    ASSERT_TRUE(buffer.empty());
+    ASSERT_EQ(buffer.commit(), 0u);
+
+    const auto entity = registry.create();
+    const auto other = registry.create();
+
+    registry.emplace<transform>(entity, 1, 2);
+    registry.emplace<transform>(other, 3, 4);
+
+    // readers don't see changes until the next commit
+    ASSERT_TRUE(buffer.empty());
+    ASSERT_EQ(buffer.commit(), 1u);
+    ASSERT_EQ(buffer.size(), 2u);
+    ASSERT_EQ(buffer.data()[0u], entity);
+    ASSERT_EQ(buffer.raw()[1u].x, 3);
+
+    // nothing changed since the last commit
+    ASSERT_EQ(buffer.commit(), 0u);
+
+    registry.patch<transform>(other, [](auto &elem) { elem.x = 5; });
+
+    ASSERT_EQ(buffer.raw()[1u].x, 3);
+    ASSERT_EQ(buffer.commit(), 1u);
+    ASSERT_EQ(buffer.raw()[1u].x, 5);
+
+    registry.destroy(entity);
+
+    ASSERT_EQ(buffer.size(), 2u);
+    ASSERT_EQ(buffer.commit(), 1u);
+    ASSERT_EQ(buffer.size(), 1u);
+
+    buffer.each([other](const entt::entity entt, const transform &elem) {
+        ASSERT_EQ(entt, other);
+        ASSERT_EQ(elem.x, 5);
+        ASSERT_EQ(elem.y, 4);
+    });
+}
+
+TEST(DoubleBuffer, DirtyPages) {
+    entt::registry registry;
+    auto &storage = registry.storage<transform>();
+    entt::double_buffer<transform> buffer{storage};
+
+    for(std::size_t pos{}; pos < ENTT_PACKED_PAGE * 4u; ++pos) {
+        registry.emplace<transform>(registry.create(), static_cast<int>(pos), 0);
+    }
+
+    ASSERT_EQ(buffer.commit(), 4u);
+
+    registry.replace<transform>(storage.data()[ENTT_PACKED_PAGE * 2u], 0, 1);
+
+    // only the page that contains the element is copied
+    ASSERT_EQ(buffer.commit(), 1u);
+    ASSERT_EQ(buffer.raw()[ENTT_PACKED_PAGE * 2u].y, 1);
+
+    storage.sort(std::less{});
+
+    ASSERT_EQ(buffer.commit(), 4u);
+    ASSERT_EQ(buffer.data()[0u], storage.data()[0u]);
+    ASSERT_EQ(buffer.raw()[0u].x, storage.raw()[0u][0u].x);
+}
+
+TEST(DoubleBuffer, EmptyType) {
+    entt::registry registry;
+    entt::double_buffer<empty_type> buffer{registry.storage<empty_type>()};
+
+    const auto entity = registry.create();
+    registry.emplace<empty_type>(entity);
+
+    ASSERT_EQ(buffer.commit(), 1u);
+    ASSERT_EQ(buffer.size(), 1u);
+    ASSERT_EQ(buffer.raw(), nullptr);
+
+    buffer.each([entity](const entt::entity entt) {
+        ASSERT_EQ(entt, entity);
+    });
+}
+
+TEST(DoubleBuffer, NonDefaultConstructibleType) {
+    entt::registry registry;
+    entt::double_buffer<no_default_type> buffer{registry.storage<no_default_type>()};
+
+    const auto entity = registry.create();
+    const auto other = registry.create();
+
+    registry.emplace<no_default_type>(entity, 1);
+    registry.emplace<no_default_type>(other, 2);
+
+    ASSERT_EQ(buffer.commit(), 1u);
+    ASSERT_EQ(buffer.size(), 2u);
+    ASSERT_EQ(buffer.raw()[1u].value, 2);
+
+    registry.destroy(entity);
+
+    ASSERT_EQ(buffer.commit(), 1u);
+    ASSERT_EQ(buffer.size(), 1u);
+    ASSERT_EQ(buffer.raw()[0u].value, 2);
+}
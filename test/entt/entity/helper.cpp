@@ -1,3 +1,5 @@
+#include <cstddef>
+#include <functional>
 #include <gtest/gtest.h>
 #include <entt/entity/component.hpp>
 #include <entt/entity/entity.hpp>
@@ -149,6 +151,124 @@ TYPED_TEST(ToEntityDeprecated, Functionalities) {
     ASSERT_EQ(entt::to_entity(registry, value), null);
 }
 
+TEST(Partition, Functionalities) {
+    entt::registry registry;
+    auto &storage = registry.storage<int>();
+    std::size_t visited{};
+
+    entt::partition(storage, 2u, [&](const std::size_t, auto first, auto last) {
+        ASSERT_EQ(first, last);
+        ++visited;
+    });
+
+    ASSERT_EQ(visited, 2u);
+
+    for(std::size_t pos{}; pos < ENTT_PACKED_PAGE * 2u + 1u; ++pos) {
+        storage.emplace(registry.create(), static_cast<int>(pos));
+    }
+
+    visited = 0u;
+
+    entt::partition(storage, 2u, [&](const std::size_t part, auto first, auto last) {
+        // pages are never split across ranges
+        ASSERT_EQ(&*(last - 1), &storage.get(storage.data()[part * ENTT_PACKED_PAGE]));
+        ASSERT_EQ(static_cast<std::size_t>(last - first), part ? (ENTT_PACKED_PAGE + 1u) : ENTT_PACKED_PAGE);
+
+        for(; first != last; ++first) {
+            ++visited;
+        }
+    });
+
+    ASSERT_EQ(visited, storage.size());
+
+    visited = 0u;
+
+    entt::partition(storage, 8u, [&](const std::size_t, auto first, auto last) {
+        visited += (first != last);
+    });
+
+    // there are only three pages
+    ASSERT_EQ(visited, 3u);
+}
+
+struct reverse_dispatcher {
+    template<typename Task>
+    void operator()(const std::size_t count, Task task) const {
+        for(auto pos = count; pos; --pos) {
+            task(pos - 1u);
+        }
+    }
+};
+
+TEST(ParallelFor, Functionalities) {
+    entt::registry registry;
+    std::size_t visited{};
+
+    entt::parallel_for(registry.view<int>(), [&](auto &&...) { ++visited; });
+
+    ASSERT_EQ(visited, 0u);
+
+    for(std::size_t pos{}; pos < ENTT_PACKED_PAGE * 2u + 1u; ++pos) {
+        const auto entity = registry.create();
+        registry.emplace<int>(entity, static_cast<int>(pos));
+
+        if(pos % 2u) {
+            registry.emplace<char>(entity);
+        }
+    }
+
+    std::size_t chunks{};
+
+    entt::parallel_for(
+        registry.view<int, const char>(), [&](const entt::entity entity, int &value, const char) {
+            ASSERT_EQ(value % 2, 1);
+            ASSERT_EQ(registry.get<int>(entity), value);
+            ++visited;
+        },
+        [&chunks](const std::size_t count, auto task) {
+            chunks = count;
+            reverse_dispatcher{}(count, task);
+        });
+
+    // chunks are made of positions of the leading storage, that is char
+    ASSERT_EQ(chunks, 1u);
+    ASSERT_EQ(visited, ENTT_PACKED_PAGE);
+
+    visited = 0u;
+    entt::parallel_for(
+        registry.view<int>(), [&](auto &&...) { ++visited; },
+        [&chunks](const std::size_t count, auto task) {
+            chunks = count;
+            reverse_dispatcher{}(count, task);
+        });
+
+    ASSERT_EQ(chunks, 3u);
+    ASSERT_EQ(visited, registry.storage<int>().size());
+}
+
+TEST(ParallelReduce, Functionalities) {
+    entt::registry registry;
+
+    ASSERT_EQ(entt::parallel_reduce(registry.view<int>(), 3, [](const entt::entity, int value) { return value; }, std::plus{}), 3);
+
+    for(std::size_t pos{}; pos < ENTT_PACKED_PAGE * 5u + 3u; ++pos) {
+        const auto entity = registry.create();
+        registry.emplace<int>(entity, static_cast<int>(pos));
+        registry.emplace<float>(entity, 1.f / static_cast<float>(pos + 1u));
+    }
+
+    const auto count = entt::parallel_reduce(registry.view<int>(), std::size_t{}, [](auto &&...) { return std::size_t{1u}; }, std::plus{});
+
+    ASSERT_EQ(count, registry.storage<int>().size());
+
+    const auto map = [](const entt::entity, const float value) { return value; };
+    const auto sum = entt::parallel_reduce(registry.view<const float>(), 0.f, map, std::plus{});
+
+    // the order in which chunks are processed doesn't affect the result
+    ASSERT_EQ(entt::parallel_reduce(registry.view<const float>(), 0.f, map, std::plus{}, reverse_dispatcher{}), sum);
+    ASSERT_NE(sum, 0.f);
+}
+
 TEST(SighHelper, Functionalities) {
     using namespace entt::literals;
 
@@ -0,0 +1,126 @@
+#define ENTT_INSTRUMENTATION
+
+#include <cstdint>
+#include <string_view>
+#include <utility>
+#include <gtest/gtest.h>
+#include <entt/core/type_info.hpp>
+#include <entt/entity/entity.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/sparse_set.hpp>
+#include <entt/entity/storage.hpp>
+#include <entt/entity/view.hpp>
+#include "../common/config.h"
+
+TEST(Instrumentation, SparseSet) {
+    entt::sparse_set set{};
+    const entt::entity entity[3u]{entt::entity{1}, entt::entity{3}, entt::entity{2}};
+
+    set.push(std::begin(entity), std::end(entity));
+
+    ASSERT_EQ(set.counters().emplaces, 3u);
+
+    const auto lookups = set.counters().lookups;
+
+    ASSERT_TRUE(set.contains(entity[0u]));
+    ASSERT_FALSE(set.contains(entt::entity{42}));
+    ASSERT_EQ(set.counters().lookups, lookups + 2u);
+
+    set.sort([](auto lhs, auto rhs) { return lhs < rhs; });
+
+    ASSERT_EQ(set.counters().sorts, 1u);
+
+    set.erase(entity[0u]);
+
+    ASSERT_EQ(set.counters().erases, 1u);
+
+    set.clear();
+
+    ASSERT_EQ(set.counters().erases, 3u);
+    ASSERT_EQ(set.counters().publishes, 0u);
+    ASSERT_EQ(set.counters().iterations, 0u);
+
+    testing::StaticAssertTypeEq<decltype(std::as_const(set).counters()), const entt::storage_counters &>();
+    testing::StaticAssertTypeEq<decltype(set.counters()), entt::storage_counters &>();
+
+    set.counters() = {};
+
+    ASSERT_EQ(set.counters().emplaces, 0u);
+    ASSERT_EQ(set.counters().lookups, 0u);
+    ASSERT_EQ(set.counters().erases, 0u);
+    ASSERT_EQ(set.counters().sorts, 0u);
+}
+
+TEST(Instrumentation, Storage) {
+    entt::storage<int> pool{};
+    const entt::entity entity[2u]{entt::entity{1}, entt::entity{3}};
+
+    pool.emplace(entity[0u], 0);
+    pool.insert(std::begin(entity) + 1, std::end(entity), 1);
+
+    ASSERT_EQ(pool.counters().emplaces, 2u);
+
+    pool.counters().lookups = {};
+
+    ASSERT_EQ(pool.get(entity[1u]), 1);
+    // assertions in debug builds don't count as lookups
+    ASSERT_EQ(pool.counters().lookups, 1u);
+    ASSERT_EQ(pool.index(entity[0u]), 0u);
+    ASSERT_EQ(pool.counters().lookups, 2u);
+
+    pool.erase(std::begin(entity), std::end(entity));
+
+    ASSERT_EQ(pool.counters().erases, 2u);
+}
+
+TEST(Instrumentation, Registry) {
+    entt::registry registry{};
+    const auto entity = registry.create();
+    const auto other = registry.create();
+
+    registry.on_construct<int>().connect<&entt::registry::emplace_or_replace<char>>();
+    registry.emplace<int>(entity);
+    registry.emplace<int>(other);
+    registry.emplace<double>(entity);
+
+    registry.view<int, double>().each([](auto &&...) {});
+    registry.view<int>().each([](auto &&...) {});
+
+    for([[maybe_unused]] auto entt: registry.view<double>()) {}
+
+    registry.sort<int>([](auto lhs, auto rhs) { return lhs < rhs; });
+    registry.destroy(other);
+
+    bool visited[4u]{};
+
+    registry.counters([&](const std::string_view name, const entt::storage_counters &counters) {
+        if(name == entt::type_id<entt::entity>().name()) {
+            ASSERT_EQ(counters.emplaces, 2u);
+            ASSERT_EQ(counters.erases, 1u);
+            visited[0u] = true;
+        } else if(name == entt::type_id<int>().name()) {
+            ASSERT_EQ(counters.emplaces, 2u);
+            ASSERT_EQ(counters.erases, 1u);
+            ASSERT_EQ(counters.publishes, 2u);
+            ASSERT_EQ(counters.sorts, 1u);
+            // the multi-type view is led by double, that is the smaller pool
+            ASSERT_EQ(counters.iterations, 1u);
+            ASSERT_GE(counters.lookups, 1u);
+            visited[1u] = true;
+        } else if(name == entt::type_id<double>().name()) {
+            ASSERT_EQ(counters.emplaces, 1u);
+            ASSERT_EQ(counters.publishes, 0u);
+            ASSERT_EQ(counters.iterations, 2u);
+            visited[2u] = true;
+        } else if(name == entt::type_id<char>().name()) {
+            ASSERT_EQ(counters.emplaces, 2u);
+            ASSERT_EQ(counters.erases, 1u);
+            visited[3u] = true;
+        }
+    });
+
+    ASSERT_TRUE(visited[0u]);
+    ASSERT_TRUE(visited[1u]);
+    ASSERT_TRUE(visited[2u]);
+    ASSERT_TRUE(visited[3u]);
+}
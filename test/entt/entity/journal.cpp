@@ -0,0 +1,141 @@
+#include <cstddef>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/core/hashed_string.hpp>
+#include <entt/entity/entity.hpp>
+#include <entt/entity/journal.hpp>
+#include <entt/entity/registry.hpp>
+
+struct empty_type {};
+
+struct position {
+    int x;
+    int y;
+};
+
+struct output {
+    void operator()(const std::byte *data, const std::size_t length) {
+        ++commits;
+        buffer.insert(buffer.end(), data, data + length);
+    }
+
+    std::vector<std::byte> buffer{};
+    int commits{};
+};
+
+TEST(Journal, Functionalities) {
+    entt::registry registry;
+    entt::journal journal{registry};
+    output archive{};
+
+    ASSERT_TRUE(journal.empty());
+    ASSERT_EQ(journal.size(), 0u);
+
+    journal.watch<position>();
+    journal.commit(archive);
+
+    ASSERT_EQ(archive.commits, 0);
+
+    const auto entity = registry.create();
+    registry.emplace<position>(entity, 1, 2);
+
+    ASSERT_FALSE(journal.empty());
+    ASSERT_NE(journal.size(), 0u);
+
+    // changes to types that aren't watched aren't recorded
+    const auto size = journal.size();
+    registry.emplace<int>(entity);
+
+    ASSERT_EQ(journal.size(), size);
+
+    journal.commit(archive);
+
+    ASSERT_TRUE(journal.empty());
+    ASSERT_EQ(archive.commits, 1);
+    ASSERT_EQ(archive.buffer.size(), size);
+
+    journal.disconnect();
+    registry.destroy(entity);
+
+    ASSERT_TRUE(journal.empty());
+}
+
+TEST(Journal, Replay) {
+    using namespace entt::literals;
+
+    entt::registry registry;
+    entt::journal journal{registry};
+    output archive{};
+
+    journal.watch<position>().watch<empty_type>().watch<position>("other"_hs);
+
+    const auto entity = registry.create();
+    const auto other = registry.create();
+
+    registry.emplace<position>(entity, 1, 2);
+    registry.emplace<empty_type>(entity);
+    registry.storage<position>("other"_hs).emplace(other, position{3, 4});
+    registry.patch<position>(entity, [](auto &elem) { elem.x = 5; });
+    registry.destroy(other);
+    registry.emplace<position>(registry.create(), 6, 7);
+    registry.erase<empty_type>(entity);
+
+    journal.commit(archive);
+    journal.disconnect();
+
+    entt::registry copy;
+    entt::journal recovery{copy};
+
+    recovery.watch<position>().watch<empty_type>().watch<position>("other"_hs);
+
+    ASSERT_EQ(recovery.replay(archive.buffer.data(), archive.buffer.size()), archive.buffer.size());
+    // nothing is recorded while replaying
+    ASSERT_TRUE(recovery.empty());
+
+    ASSERT_EQ(copy.storage<entt::entity>().size(), registry.storage<entt::entity>().size());
+    ASSERT_EQ(copy.storage<entt::entity>().free_list(), registry.storage<entt::entity>().free_list());
+
+    for(auto [entt, elem]: registry.view<position>().each()) {
+        ASSERT_TRUE(copy.valid(entt));
+        ASSERT_EQ(copy.get<position>(entt).x, elem.x);
+        ASSERT_EQ(copy.get<position>(entt).y, elem.y);
+    }
+
+    ASSERT_EQ(copy.get<position>(entity).x, 5);
+    ASSERT_FALSE(copy.all_of<empty_type>(entity));
+    ASSERT_FALSE(copy.valid(other));
+    ASSERT_TRUE(copy.storage<position>("other"_hs).empty());
+
+    recovery.disconnect();
+}
+
+TEST(Journal, TornWrite) {
+    entt::registry registry;
+    entt::journal journal{registry};
+    output archive{};
+
+    journal.watch<position>();
+    registry.emplace<position>(registry.create(), 1, 2);
+    journal.commit(archive);
+
+    const auto length = archive.buffer.size();
+    const auto entity = registry.create();
+    registry.emplace<position>(entity, 3, 4);
+    journal.commit(archive);
+    journal.disconnect();
+
+    entt::registry copy;
+    entt::journal recovery{copy};
+    recovery.watch<position>();
+
+    // the last record was only partially written
+    const auto consumed = recovery.replay(archive.buffer.data(), archive.buffer.size() - 1u);
+
+    ASSERT_GE(consumed, length);
+    ASSERT_LT(consumed, archive.buffer.size());
+    ASSERT_TRUE(copy.valid(entity));
+    ASSERT_FALSE(copy.all_of<position>(entity));
+    ASSERT_EQ(copy.storage<position>().size(), 1u);
+
+    recovery.disconnect();
+}
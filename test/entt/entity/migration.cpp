@@ -0,0 +1,148 @@
+#include <array>
+#include <memory>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/core/hashed_string.hpp>
+#include <entt/entity/entity.hpp>
+#include <entt/entity/migration.hpp>
+#include <entt/entity/page_pool.hpp>
+#include <entt/entity/registry.hpp>
+
+struct empty_type {};
+
+struct relationship {
+    entt::entity parent;
+    std::vector<entt::entity> children;
+};
+
+struct counter {
+    void incr() {
+        ++value;
+    }
+
+    int value{};
+};
+
+TEST(Migration, Functionalities) {
+    entt::registry source;
+    entt::registry destination;
+    entt::migration migration{source, destination};
+    std::array<entt::entity, 3u> entity{};
+
+    source.create(entity.begin(), entity.end());
+    source.emplace<int>(entity[0u], 0);
+    source.emplace<int>(entity[2u], 2);
+    source.emplace<empty_type>(entity[1u]);
+
+    // entities already in use in the destination aren't reused
+    ASSERT_EQ(destination.create(entity[1u]), entity[1u]);
+
+    ASSERT_FALSE(migration.contains(entity[0u]));
+    ASSERT_EQ(migration.map(entity[0u]), static_cast<entt::entity>(entt::null));
+
+    migration.entities(entity.begin(), entity.begin() + 2u).get<int>().get<empty_type>();
+
+    ASSERT_TRUE(migration.contains(entity[0u]));
+    ASSERT_TRUE(migration.contains(entity[1u]));
+    ASSERT_FALSE(migration.contains(entity[2u]));
+
+    ASSERT_TRUE(destination.valid(migration.map(entity[0u])));
+    ASSERT_TRUE(destination.valid(migration.map(entity[1u])));
+    ASSERT_NE(migration.map(entity[1u]), entity[1u]);
+
+    ASSERT_EQ(destination.get<int>(migration.map(entity[0u])), 0);
+    ASSERT_TRUE(destination.all_of<empty_type>(migration.map(entity[1u])));
+    ASSERT_EQ(destination.storage<int>().size(), 1u);
+
+    // elements are removed from the source, entities aren't destroyed yet
+    ASSERT_TRUE(source.valid(entity[0u]));
+    ASSERT_TRUE(source.orphan(entity[0u]));
+    ASSERT_TRUE(source.orphan(entity[1u]));
+    ASSERT_EQ(source.get<int>(entity[2u]), 2);
+
+    migration.destroy();
+
+    ASSERT_FALSE(source.valid(entity[0u]));
+    ASSERT_FALSE(source.valid(entity[1u]));
+    ASSERT_TRUE(source.valid(entity[2u]));
+    ASSERT_TRUE(migration.contains(entity[0u]));
+}
+
+TEST(Migration, MoveOnlyType) {
+    using namespace entt::literals;
+
+    entt::registry source;
+    entt::registry destination;
+    entt::migration migration{source, destination};
+
+    const auto entity = source.create();
+    source.storage<std::unique_ptr<int>>("named"_hs).emplace(entity, std::make_unique<int>(4));
+
+    migration.entities(&entity, &entity + 1u).get<std::unique_ptr<int>>("named"_hs);
+
+    ASSERT_TRUE(source.storage<std::unique_ptr<int>>("named"_hs).empty());
+    ASSERT_TRUE(destination.storage<std::unique_ptr<int>>().empty());
+    ASSERT_EQ(*destination.storage<std::unique_ptr<int>>("named"_hs).get(migration.map(entity)), 4);
+}
+
+TEST(Migration, Members) {
+    entt::registry source;
+    entt::registry destination;
+    entt::migration migration{source, destination};
+    std::array<entt::entity, 3u> entity{};
+
+    // shift identifiers so that counterparts differ from the originals
+    destination.create(entity.begin(), entity.end());
+    source.create(entity.begin(), entity.end());
+
+    source.emplace<relationship>(entity[0u], entt::null, std::vector<entt::entity>{entity[1u], entity[2u]});
+    source.emplace<relationship>(entity[1u], entity[0u]);
+
+    migration.entities(entity.begin(), entity.begin() + 2u).get<relationship, &relationship::parent, &relationship::children>();
+
+    const auto &parent = destination.get<relationship>(migration.map(entity[0u]));
+    const auto &child = destination.get<relationship>(migration.map(entity[1u]));
+
+    ASSERT_EQ(parent.parent, static_cast<entt::entity>(entt::null));
+    ASSERT_EQ(parent.children.size(), 2u);
+    ASSERT_EQ(parent.children[0u], migration.map(entity[1u]));
+    // entities that weren't migrated are left unchanged
+    ASSERT_EQ(parent.children[1u], entity[2u]);
+    ASSERT_EQ(child.parent, migration.map(entity[0u]));
+}
+
+TEST(Migration, Signals) {
+    entt::registry source;
+    entt::registry destination;
+    entt::migration migration{source, destination};
+    counter counter{};
+
+    source.on_destroy<int>().connect<&counter::incr>(counter);
+    destination.on_construct<int>().connect<&counter::incr>(counter);
+
+    const auto entity = source.create();
+    source.emplace<int>(entity);
+    migration.entities(&entity, &entity + 1u).get<int>();
+
+    ASSERT_EQ(counter.value, 2);
+}
+
+TEST(Migration, CustomAllocator) {
+    using allocator_type = entt::page_allocator<entt::entity>;
+    using registry_type = entt::basic_registry<entt::entity, allocator_type>;
+
+    entt::page_pool pool{};
+    registry_type source{allocator_type{pool}};
+    registry_type destination{allocator_type{pool}};
+    entt::basic_migration<registry_type> migration{source, destination};
+    std::array<entt::entity, 3u> entity{};
+
+    source.create(entity.begin(), entity.end());
+    source.insert<int>(entity.begin(), entity.end(), 2);
+
+    migration.entities(entity.begin(), entity.end()).get<int>().destroy();
+
+    ASSERT_TRUE(source.storage<int>().empty());
+    ASSERT_EQ(destination.storage<int>().size(), 3u);
+    ASSERT_EQ(destination.get<int>(migration.map(entity[1u])), 2);
+}
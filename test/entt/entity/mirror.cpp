@@ -0,0 +1,100 @@
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <entt/entity/entity.hpp>
+#include <entt/entity/mirror.hpp>
+#include <entt/entity/storage.hpp>
+
+struct empty_type {};
+
+struct stable_type {
+    static constexpr auto in_place_delete = true;
+    int value;
+};
+
+TEST(Mirror, Functionalities) {
+    alignas(std::max_align_t) std::byte memory[16384u];
+    entt::mirror<int> mirror{memory, sizeof(memory)};
+    entt::storage<int> storage;
+    std::size_t visited{};
+
+    mirror.reset();
+
+    ASSERT_TRUE(mirror.read([&](const entt::entity *, const int *, std::size_t count) { visited = count; }));
+    ASSERT_EQ(visited, 0u);
+
+    for(std::size_t pos{}; pos < ENTT_PACKED_PAGE + 3u; ++pos) {
+        storage.emplace(entt::entity(pos), static_cast<int>(pos));
+    }
+
+    ASSERT_LT(entt::mirror<int>::required_size(storage.size()), sizeof(memory));
+    ASSERT_TRUE(mirror.publish(storage));
+
+    ASSERT_TRUE(mirror.read([&](const entt::entity *entities, const int *elements, std::size_t count) {
+        ASSERT_EQ(count, storage.size());
+
+        for(visited = 0u; visited < count; ++visited) {
+            ASSERT_EQ(entities[visited], storage.data()[visited]);
+            ASSERT_EQ(elements[visited], storage.get(entities[visited]));
+        }
+    }));
+
+    ASSERT_EQ(visited, storage.size());
+}
+
+TEST(Mirror, NotEnoughSpace) {
+    alignas(std::max_align_t) std::byte memory[64u];
+    entt::mirror<int> mirror{memory, sizeof(memory)};
+    entt::storage<int> storage;
+
+    mirror.reset();
+
+    for(std::size_t pos{}; pos < 16u; ++pos) {
+        storage.emplace(entt::entity(pos));
+    }
+
+    ASSERT_GT(entt::mirror<int>::required_size(storage.size()), sizeof(memory));
+    ASSERT_FALSE(mirror.publish(storage));
+}
+
+TEST(Mirror, TornRead) {
+    alignas(std::max_align_t) std::byte memory[1024u];
+    entt::mirror<stable_type> mirror{memory, sizeof(memory)};
+    entt::storage<stable_type> storage;
+
+    mirror.reset();
+    storage.emplace(entt::entity{1}, 1);
+    storage.emplace(entt::entity{3}, 3);
+    storage.erase(entt::entity{1});
+
+    ASSERT_TRUE(mirror.publish(storage));
+
+    // tombstones are part of the region
+    ASSERT_TRUE(mirror.read([](const entt::entity *entities, const stable_type *elements, std::size_t count) {
+        ASSERT_EQ(count, 2u);
+        ASSERT_EQ(entities[0u], static_cast<entt::entity>(entt::tombstone));
+        ASSERT_EQ(entities[1u], entt::entity{3});
+        ASSERT_EQ(elements[1u].value, 3);
+    }));
+
+    // a publication during a read invalidates the read
+    ASSERT_FALSE(mirror.read([&](const entt::entity *, const stable_type *, std::size_t) { ASSERT_TRUE(mirror.publish(storage)); }));
+    ASSERT_TRUE(mirror.read([](auto &&...) {}));
+}
+
+TEST(Mirror, EmptyType) {
+    alignas(std::max_align_t) std::byte memory[256u];
+    entt::mirror<empty_type> mirror{memory, sizeof(memory)};
+    entt::storage<empty_type> storage;
+
+    mirror.reset();
+    storage.emplace(entt::entity{2});
+
+    ASSERT_EQ(entt::mirror<empty_type>::required_size(0u) + sizeof(entt::entity), entt::mirror<empty_type>::required_size(1u));
+    ASSERT_TRUE(mirror.publish(storage));
+
+    ASSERT_TRUE(mirror.read([](const entt::entity *entities, const empty_type *elements, std::size_t count) {
+        ASSERT_EQ(count, 1u);
+        ASSERT_EQ(entities[0u], entt::entity{2});
+        ASSERT_EQ(elements, nullptr);
+    }));
+}
@@ -0,0 +1,99 @@
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <entt/entity/component.hpp>
+#include <entt/entity/entity.hpp>
+#include <entt/entity/page_pool.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/storage.hpp>
+
+struct alignas(64u) over_aligned {
+    int value{};
+};
+
+TEST(PagePool, Functionalities) {
+    entt::page_pool pool{64u};
+
+    ASSERT_EQ(pool.stats(128u).size, 128u);
+    ASSERT_EQ(pool.stats(128u).allocated, 0u);
+
+    void *page = pool.allocate(128u);
+
+    ASSERT_EQ(pool.stats(128u).allocated, 1u);
+    ASSERT_EQ(pool.stats(128u).in_use, 1u);
+
+    pool.deallocate(page, 128u);
+
+    ASSERT_EQ(pool.stats(128u).allocated, 1u);
+    ASSERT_EQ(pool.stats(128u).in_use, 0u);
+
+    // returned pages are handed out again
+    ASSERT_EQ(pool.allocate(128u), page);
+    ASSERT_EQ(pool.stats(128u).reused, 1u);
+
+    pool.deallocate(page, 128u);
+    pool.release();
+
+    ASSERT_EQ(pool.stats(128u).allocated, 0u);
+
+    // small requests aren't pooled
+    pool.deallocate(pool.allocate(16u), 16u);
+
+    std::size_t classes{};
+    pool.each([&classes](const entt::page_stats &) { ++classes; });
+
+    ASSERT_EQ(classes, 1u);
+}
+
+TEST(PagePool, Registry) {
+    using allocator_type = entt::page_allocator<entt::entity>;
+    using traits_type = entt::component_traits<int>;
+
+    entt::page_pool pool{};
+    entt::basic_registry<entt::entity, allocator_type> registry{allocator_type{pool}};
+    constexpr auto bytes = traits_type::page_size * sizeof(int);
+
+    auto &storage = registry.storage<int>();
+    const auto entity = registry.create();
+
+    storage.emplace(entity, 1);
+
+    ASSERT_EQ(pool.stats(bytes).in_use, 1u);
+
+    storage.erase(entity);
+    storage.shrink_to_fit();
+
+    // pages are returned on shrink and reused by other storage
+    ASSERT_EQ(pool.stats(bytes).in_use, 0u);
+    ASSERT_EQ(pool.stats(bytes).allocated, 1u);
+
+    registry.storage<float>().emplace(entity, 1.f);
+
+    ASSERT_EQ(pool.stats(bytes).in_use, 1u);
+    ASSERT_EQ(pool.stats(bytes).reused, 1u);
+
+    registry.emplace<over_aligned>(entity, 4);
+
+    ASSERT_EQ(registry.get<over_aligned>(entity).value, 4);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(&registry.get<over_aligned>(entity)) % alignof(over_aligned), 0u);
+}
+
+TEST(PagePool, OnlyPages) {
+    using allocator_type = entt::page_allocator<entt::entity>;
+    using traits_type = entt::component_traits<int>;
+
+    entt::page_pool pool{};
+    entt::basic_registry<entt::entity, allocator_type> registry{allocator_type{pool}};
+    auto &storage = registry.storage<int>();
+
+    for(std::size_t pos{}; pos < 3u * traits_type::page_size; ++pos) {
+        storage.emplace(registry.create(), 0);
+    }
+
+    // packed arrays grow through many sizes, none of them ends up in the pool
+    pool.each([](const entt::page_stats &stats) {
+        ASSERT_TRUE(stats.size == traits_type::page_size * sizeof(int) || stats.size == ENTT_SPARSE_PAGE * sizeof(entt::entity));
+    });
+
+    ASSERT_EQ(pool.stats(traits_type::page_size * sizeof(int)).in_use, 3u);
+}
@@ -424,6 +424,45 @@ TEST(Registry, Move) {
     ASSERT_EQ(test.parent, &registry);
 }
 
+TEST(Registry, Fork) {
+    entt::registry registry;
+    listener listener;
+
+    const auto entity = registry.create();
+    const auto other = registry.create();
+    registry.destroy(registry.create());
+
+    registry.emplace<int>(entity, 42);
+    registry.emplace<stable_type>(other, 3);
+    registry.emplace<empty_type>(entity);
+    registry.emplace<std::unique_ptr<int>>(entity);
+    registry.on_construct<int>().connect<&listener::incr>(listener);
+    registry.ctx().emplace<char>('c');
+
+    auto fork = registry.fork();
+
+    ASSERT_EQ(fork.storage<entt::entity>().size(), 3u);
+    ASSERT_EQ(fork.storage<entt::entity>().free_list(), 2u);
+    ASSERT_TRUE(fork.valid(entity));
+    ASSERT_TRUE(fork.valid(other));
+    ASSERT_EQ(fork.get<int>(entity), 42);
+    ASSERT_EQ(fork.get<stable_type>(other).value, 3);
+    ASSERT_TRUE(fork.all_of<empty_type>(entity));
+    // non-copyable types and context variables aren't forked
+    ASSERT_FALSE(fork.all_of<std::unique_ptr<int>>(entity));
+    ASSERT_FALSE(fork.ctx().contains<char>());
+
+    fork.emplace<int>(other, 3);
+    fork.get<int>(entity) = 0;
+    fork.destroy(entity);
+
+    ASSERT_EQ(listener.counter, 0);
+    ASSERT_TRUE(registry.valid(entity));
+    ASSERT_EQ(registry.get<int>(entity), 42);
+    ASSERT_FALSE(registry.all_of<int>(other));
+    ASSERT_FALSE(fork.valid(entity));
+}
+
 TEST(Registry, Swap) {
     entt::registry registry;
     const auto entity = registry.create();
@@ -547,6 +586,64 @@ TEST(Registry, CreateManyEntitiesAtOnceWithListener) {
     ASSERT_EQ(listener.counter, 6);
 }
 
+TEST(Registry, Instantiate) {
+    entt::registry registry;
+    entt::entity entity[3];
+    listener other;
+    listener listener;
+
+    const auto prefab = registry.create();
+    registry.destroy(registry.create());
+
+    registry.emplace<int>(prefab, 42);
+    registry.emplace<stable_type>(prefab, 3);
+    registry.emplace<empty_type>(prefab);
+    registry.emplace<std::unique_ptr<int>>(prefab);
+    registry.storage<char>();
+
+    registry.on_construct<int>().connect<&listener::incr>(listener);
+    registry.on_construct<empty_type>().connect<&listener::incr>(other);
+    registry.instantiate(prefab, std::begin(entity), std::end(entity));
+
+    ASSERT_EQ(listener.counter, 3);
+    // signals are sent once per entity, even when elements are assigned one at a time
+    ASSERT_EQ(other.counter, 3);
+    ASSERT_EQ(listener.last, entity[0]);
+    ASSERT_EQ(registry.storage<entt::entity>().free_list(), 4u);
+
+    for(auto entt: entity) {
+        ASSERT_TRUE(registry.valid(entt));
+        ASSERT_NE(entt, prefab);
+        ASSERT_EQ(registry.get<int>(entt), 42);
+        ASSERT_EQ(registry.get<stable_type>(entt).value, 3);
+        ASSERT_TRUE(registry.all_of<empty_type>(entt));
+        // non-copyable types are ignored
+        ASSERT_FALSE((registry.any_of<std::unique_ptr<int>, char>(entt)));
+    }
+
+    registry.instantiate(prefab, std::begin(entity), std::begin(entity));
+
+    ASSERT_EQ(listener.counter, 3);
+    ASSERT_EQ(registry.storage<int>().size(), 4u);
+}
+
+TEST(Registry, InstantiateWithGroup) {
+    entt::registry registry;
+    entt::entity entity[2];
+
+    const auto group = registry.group<int>(entt::get<char>);
+    const auto prefab = registry.create();
+
+    registry.emplace<int>(prefab, 1);
+    registry.emplace<char>(prefab, 'c');
+    registry.instantiate(prefab, std::begin(entity), std::end(entity));
+
+    ASSERT_EQ(group.size(), 3u);
+    ASSERT_TRUE(group.contains(entity[0]));
+    ASSERT_TRUE(group.contains(entity[1]));
+    ASSERT_EQ(group.get<char>(entity[1]), 'c');
+}
+
 TEST(Registry, CreateWithHint) {
     using traits_type = entt::entt_traits<entt::entity>;
 
@@ -745,6 +842,40 @@ TEST(Registry, DestroyRange) {
     ASSERT_EQ(registry.storage<int>().size(), 0u);
 }
 
+TEST(Registry, DestroyRangeSmallStorage) {
+    entt::registry registry;
+    entt::entity entity[8u];
+
+    registry.create(std::begin(entity), std::end(entity));
+    registry.insert<int>(std::begin(entity), std::end(entity));
+
+    registry.emplace<char>(entity[1u]);
+    registry.emplace<char>(entity[6u]);
+    registry.emplace<stable_type>(entity[2u]);
+    registry.emplace<stable_type>(entity[3u]);
+    registry.emplace<stable_type>(entity[5u]);
+    registry.erase<stable_type>(entity[3u]);
+
+    // storage smaller than the range are visited in its place
+    registry.destroy(std::begin(entity), std::begin(entity) + 4u);
+
+    ASSERT_FALSE(registry.valid(entity[1u]));
+    ASSERT_TRUE(registry.valid(entity[4u]));
+
+    ASSERT_EQ(registry.storage<int>().size(), 4u);
+    ASSERT_EQ(registry.storage<char>().size(), 1u);
+    ASSERT_TRUE(registry.all_of<char>(entity[6u]));
+    ASSERT_EQ(registry.storage<stable_type>().size(), 3u);
+    ASSERT_TRUE(registry.all_of<stable_type>(entity[5u]));
+    ASSERT_FALSE(registry.storage<stable_type>().contains(entity[2u]));
+
+    registry.destroy(std::begin(entity) + 4u, std::end(entity));
+
+    ASSERT_TRUE(registry.storage<int>().empty());
+    ASSERT_TRUE(registry.storage<char>().empty());
+    ASSERT_FALSE(registry.storage<stable_type>().contains(entity[5u]));
+}
+
 TEST(Registry, StableDestroy) {
     entt::registry registry;
     const auto iview = registry.view<int>();
@@ -1801,6 +1932,56 @@ TEST(Registry, Compact) {
     ASSERT_EQ(registry.storage<stable_type>().size(), 0u);
 }
 
+TEST(Registry, CompactStep) {
+    entt::registry registry;
+    entt::entity entity[4u];
+
+    registry.create(std::begin(entity), std::end(entity));
+    registry.insert<int>(std::begin(entity), std::end(entity));
+    registry.insert<stable_type>(std::begin(entity), std::end(entity));
+    registry.destroy(entity, entity + 2u);
+
+    ASSERT_EQ(registry.storage<stable_type>().size(), 4u);
+    ASSERT_TRUE(registry.compact_step<int>(1u));
+    ASSERT_FALSE(registry.compact_step(1u));
+    ASSERT_EQ(registry.storage<stable_type>().size(), 3u);
+    ASSERT_TRUE(registry.compact_step(1u));
+    ASSERT_EQ(registry.storage<stable_type>().size(), 2u);
+}
+
+TEST(Registry, Freeze) {
+    entt::registry registry;
+    const auto entity = registry.create();
+
+    registry.emplace<int>(entity);
+    registry.storage<char>();
+
+    ASSERT_FALSE(registry.frozen());
+
+    registry.freeze();
+
+    ASSERT_TRUE(registry.frozen());
+
+    registry.emplace<char>(entity);
+    registry.erase<int>(entity);
+
+    ASSERT_TRUE(registry.all_of<char>(entity));
+    ASSERT_FALSE(registry.all_of<int>(entity));
+
+    registry.freeze(false);
+    registry.emplace<double>(entity);
+
+    ASSERT_FALSE(registry.frozen());
+    ASSERT_TRUE(registry.all_of<double>(entity));
+}
+
+ENTT_DEBUG_TEST(RegistryDeathTest, Freeze) {
+    entt::registry registry;
+    registry.freeze();
+
+    ASSERT_DEATH([[maybe_unused]] auto &&storage = registry.storage<int>(), "");
+}
+
 TEST(Registry, NonOwningGroupInterleaved) {
     entt::registry registry;
     typename entt::entity entity = entt::null;
@@ -0,0 +1,108 @@
+#include <algorithm>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/entity/entity.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/relation.hpp>
+
+struct likes {};
+
+template<typename Iterable>
+auto sorted(Iterable iterable) {
+    std::vector<entt::entity> result{iterable.begin(), iterable.end()};
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+TEST(Relation, Functionalities) {
+    entt::registry registry;
+    entt::relation<likes> relation{registry};
+    entt::entity entity[4u]{};
+
+    registry.create(std::begin(entity), std::end(entity));
+
+    ASSERT_TRUE(relation.empty());
+    ASSERT_EQ(relation.size(), 0u);
+    ASSERT_TRUE(relation.targets(entity[0u]).begin() == relation.targets(entity[0u]).end());
+
+    ASSERT_TRUE(relation.emplace(entity[0u], entity[1u]));
+    ASSERT_TRUE(relation.emplace(entity[0u], entity[2u]));
+    ASSERT_TRUE(relation.emplace(entity[3u], entity[2u]));
+    ASSERT_TRUE(relation.emplace(entity[2u], entity[2u]));
+    ASSERT_FALSE(relation.emplace(entity[0u], entity[1u]));
+
+    ASSERT_FALSE(relation.empty());
+    ASSERT_EQ(relation.size(), 4u);
+    ASSERT_TRUE(relation.contains(entity[0u], entity[1u]));
+    ASSERT_FALSE(relation.contains(entity[1u], entity[0u]));
+
+    ASSERT_EQ(sorted(relation.targets(entity[0u])), (std::vector{entity[1u], entity[2u]}));
+    ASSERT_EQ(sorted(relation.sources(entity[2u])), (std::vector{entity[0u], entity[2u], entity[3u]}));
+    ASSERT_EQ(sorted(relation.sources(entity[1u])), (std::vector{entity[0u]}));
+
+    ASSERT_TRUE(relation.remove(entity[0u], entity[1u]));
+    ASSERT_FALSE(relation.remove(entity[0u], entity[1u]));
+
+    ASSERT_EQ(relation.size(), 3u);
+    ASSERT_EQ(sorted(relation.targets(entity[0u])), (std::vector{entity[2u]}));
+    ASSERT_TRUE(relation.sources(entity[1u]).begin() == relation.sources(entity[1u]).end());
+
+    ASSERT_TRUE(relation.remove(entity[0u], entity[2u]));
+    ASSERT_EQ(sorted(relation.sources(entity[2u])), (std::vector{entity[2u], entity[3u]}));
+
+    relation.clear();
+
+    ASSERT_TRUE(relation.empty());
+    ASSERT_TRUE(relation.sources(entity[2u]).begin() == relation.sources(entity[2u]).end());
+}
+
+TEST(Relation, Destroy) {
+    entt::registry registry;
+    entt::relation<likes> relation{registry};
+    entt::entity entity[4u]{};
+
+    registry.create(std::begin(entity), std::end(entity));
+
+    relation.emplace(entity[0u], entity[1u]);
+    relation.emplace(entity[1u], entity[1u]);
+    relation.emplace(entity[1u], entity[2u]);
+    relation.emplace(entity[2u], entity[1u]);
+    relation.emplace(entity[3u], entity[2u]);
+    relation.emplace(entity[0u], entity[3u]);
+
+    registry.destroy(entity[1u]);
+
+    ASSERT_EQ(relation.size(), 2u);
+    ASSERT_TRUE(relation.contains(entity[3u], entity[2u]));
+    ASSERT_TRUE(relation.contains(entity[0u], entity[3u]));
+    ASSERT_EQ(sorted(relation.targets(entity[0u])), (std::vector{entity[3u]}));
+    ASSERT_EQ(sorted(relation.sources(entity[2u])), (std::vector{entity[3u]}));
+    ASSERT_TRUE(relation.targets(entity[2u]).begin() == relation.targets(entity[2u]).end());
+
+    ASSERT_EQ(relation.remove(entity[3u]), 2u);
+    ASSERT_TRUE(relation.empty());
+}
+
+TEST(Relation, Each) {
+    entt::registry registry;
+    entt::relation<likes> relation{registry};
+    entt::entity entity[4u]{};
+
+    registry.create(std::begin(entity), std::end(entity));
+    registry.emplace<int>(entity[1u], 1);
+    registry.emplace<int>(entity[3u], 3);
+
+    relation.emplace(entity[1u], entity[0u]);
+    relation.emplace(entity[2u], entity[0u]);
+    relation.emplace(entity[3u], entity[0u]);
+
+    std::size_t count{};
+    relation.each([&count](const entt::entity, const entt::entity) { ++count; });
+
+    ASSERT_EQ(count, 3u);
+
+    int sum{};
+    relation.each(entity[0u], registry.view<int>(), [&sum](const entt::entity, const int value) { sum += value; });
+
+    ASSERT_EQ(sum, 4);
+}
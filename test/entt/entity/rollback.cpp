@@ -0,0 +1,137 @@
+#include <memory>
+#include <gtest/gtest.h>
+#include <entt/entity/entity.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/rollback.hpp>
+
+struct stable_type {
+    static constexpr auto in_place_delete = true;
+    int value;
+};
+
+struct counter {
+    void incr() {
+        ++value;
+    }
+
+    int value{};
+};
+
+TEST(Rollback, Functionalities) {
+    entt::registry registry;
+    entt::rollback rollback{registry, 2u};
+
+    ASSERT_EQ(rollback.capacity(), 2u);
+    ASSERT_FALSE(rollback.contains(0u));
+
+    const auto entity = registry.create();
+    registry.emplace<int>(entity, 1);
+    rollback.save(0u);
+
+    ASSERT_TRUE(rollback.contains(0u));
+    ASSERT_FALSE(rollback.contains(1u));
+
+    registry.get<int>(entity) = 2;
+    const auto other = registry.create();
+    registry.emplace<int>(other, 3);
+    rollback.save(1u);
+
+    registry.destroy(entity);
+    rollback.save(2u);
+
+    // the oldest state is overwritten
+    ASSERT_FALSE(rollback.contains(0u));
+    ASSERT_TRUE(rollback.contains(1u));
+    ASSERT_TRUE(rollback.contains(2u));
+
+    rollback.rollback(1u);
+
+    ASSERT_TRUE(registry.valid(entity));
+    ASSERT_TRUE(registry.valid(other));
+    ASSERT_EQ(registry.get<int>(entity), 2);
+    ASSERT_EQ(registry.get<int>(other), 3);
+
+    // later states are discarded
+    ASSERT_TRUE(rollback.contains(1u));
+    ASSERT_FALSE(rollback.contains(2u));
+
+    rollback.clear();
+
+    ASSERT_FALSE(rollback.contains(1u));
+}
+
+TEST(Rollback, EntityStorage) {
+    entt::registry registry;
+    entt::rollback rollback{registry};
+
+    const auto entity = registry.create();
+    registry.destroy(registry.create());
+    rollback.save(0u);
+
+    const auto other = registry.create();
+    registry.destroy(entity);
+
+    ASSERT_TRUE(registry.valid(other));
+
+    rollback.rollback(0u);
+
+    ASSERT_TRUE(registry.valid(entity));
+    ASSERT_FALSE(registry.valid(other));
+    ASSERT_EQ(registry.storage<entt::entity>().free_list(), 1u);
+    ASSERT_EQ(registry.create(), other);
+}
+
+TEST(Rollback, Pools) {
+    entt::registry registry;
+    entt::rollback rollback{registry};
+    counter counter{};
+
+    const auto entity = registry.create();
+    registry.emplace<stable_type>(entity, 1);
+    registry.emplace<std::unique_ptr<int>>(entity);
+    registry.on_destroy<stable_type>().connect<&counter::incr>(counter);
+    registry.on_construct<char>().connect<&counter::incr>(counter);
+    rollback.save(0u);
+
+    registry.erase<stable_type>(entity);
+    registry.emplace<char>(entity, 'c');
+    registry.emplace<double>(entity, 1.);
+
+    ASSERT_EQ(counter.value, 2);
+
+    rollback.rollback(0u);
+
+    // no signals are sent for the pools that are restored
+    ASSERT_EQ(counter.value, 2);
+    ASSERT_EQ(registry.get<stable_type>(entity).value, 1);
+    ASSERT_FALSE((registry.any_of<char, double>(entity)));
+    // pools of non-copyable types aren't saved and are cleared instead
+    ASSERT_FALSE(registry.all_of<std::unique_ptr<int>>(entity));
+
+    registry.emplace<char>(entity, 'c');
+    registry.erase<stable_type>(entity);
+
+    // listeners are still connected after a rollback
+    ASSERT_EQ(counter.value, 4);
+}
+
+TEST(Rollback, ClearedPools) {
+    entt::registry registry;
+    entt::rollback rollback{registry};
+    counter counter{};
+
+    const auto entity = registry.create();
+    rollback.save(0u);
+
+    registry.on_destroy<char>().connect<&counter::incr>(counter);
+    registry.emplace<char>(entity, 'c');
+    registry.destroy(registry.create());
+
+    rollback.rollback(0u);
+
+    // pools created after the save are cleared while their entities are still valid
+    ASSERT_EQ(counter.value, 1);
+    ASSERT_TRUE(registry.storage<char>().empty());
+    ASSERT_TRUE(registry.valid(entity));
+    ASSERT_EQ(registry.storage<entt::entity>().free_list(), 1u);
+}
@@ -0,0 +1,110 @@
+#include <cstddef>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/entity/entity.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/sharded_registry.hpp>
+
+struct position {
+    int x;
+    int y;
+};
+
+TEST(ShardedRegistry, Functionalities) {
+    entt::sharded_registry shards{3u};
+
+    ASSERT_FALSE(std::is_copy_constructible_v<entt::sharded_registry>);
+    ASSERT_FALSE(std::is_move_constructible_v<entt::sharded_registry>);
+
+    ASSERT_EQ(shards.size(), 3u);
+    ASSERT_NE(&shards.shard(0u), &shards.shard(1u));
+    ASSERT_EQ(&std::as_const(shards).shard(2u), &shards.shard(2u));
+
+    const auto handle = shards.create(1u);
+
+    ASSERT_EQ(handle.first, 1u);
+    ASSERT_TRUE(shards.valid(handle));
+    ASSERT_TRUE(shards.shard(1u).valid(handle.second));
+    ASSERT_FALSE(shards.valid({0u, handle.second}));
+    ASSERT_FALSE(shards.valid({3u, handle.second}));
+
+    std::size_t visited{};
+    shards.each([&](const std::size_t pos, entt::registry &registry) {
+        ASSERT_EQ(&registry, &shards.shard(pos));
+        ++visited;
+    });
+
+    ASSERT_EQ(visited, 3u);
+}
+
+TEST(ShardedRegistry, Parallel) {
+    entt::sharded_registry shards{4u};
+    std::vector<std::thread> workers{};
+
+    for(std::size_t pos{}; pos < shards.size(); ++pos) {
+        workers.emplace_back([&shards, pos]() {
+            auto &registry = shards.shard(pos);
+
+            for(int next{}; next < 128; ++next) {
+                registry.emplace<position>(registry.create(), next, static_cast<int>(pos));
+            }
+        });
+    }
+
+    for(auto &&worker: workers) {
+        worker.join();
+    }
+
+    shards.each([](const std::size_t pos, entt::registry &registry) {
+        ASSERT_EQ(registry.storage<position>().size(), 128u);
+
+        for(auto [entt, elem]: registry.view<position>().each()) {
+            ASSERT_EQ(elem.y, static_cast<int>(pos));
+        }
+    });
+}
+
+TEST(ShardedRegistry, Move) {
+    entt::sharded_registry shards{2u};
+    std::vector<std::pair<entt::sharded_registry::handle_type, entt::sharded_registry::handle_type>> moved{};
+
+    const auto handle = shards.create(0u);
+    const auto other = shards.create(0u);
+    const auto local = shards.create(1u);
+
+    shards.shard(0u).emplace<position>(handle.second, 1, 2);
+    shards.shard(0u).emplace<int>(handle.second, 3);
+    shards.shard(0u).emplace<position>(other.second, 4, 5);
+
+    shards.move(handle, 1u);
+    shards.move(other, 0u);
+
+    // nothing happens until flushed
+    ASSERT_TRUE(shards.valid(handle));
+    ASSERT_EQ(shards.shard(1u).storage<position>().size(), 0u);
+
+    shards.flush<position>([&](auto from, auto to) { moved.emplace_back(from, to); });
+
+    ASSERT_EQ(moved.size(), 1u);
+    ASSERT_EQ(moved[0u].first, handle);
+    ASSERT_EQ(moved[0u].second.first, 1u);
+    ASSERT_NE(moved[0u].second.second, local.second);
+
+    ASSERT_FALSE(shards.valid(handle));
+    ASSERT_TRUE(shards.valid(other));
+    ASSERT_TRUE(shards.valid(moved[0u].second));
+    ASSERT_EQ(shards.shard(1u).get<position>(moved[0u].second.second).x, 1);
+    ASSERT_EQ(shards.shard(1u).get<position>(moved[0u].second.second).y, 2);
+    // only the requested types are moved
+    ASSERT_FALSE(shards.shard(1u).all_of<int>(moved[0u].second.second));
+    ASSERT_TRUE(shards.shard(0u).storage<int>().empty());
+
+    shards.move(other, 1u);
+    shards.flush<position>();
+
+    ASSERT_FALSE(shards.valid(other));
+    ASSERT_EQ(shards.shard(1u).storage<position>().size(), 2u);
+}
@@ -379,6 +379,29 @@ TEST(SighMixin, Move) {
     ASSERT_EQ(on_destroy.value, 1);
 }
 
+TEST(SighMixin, Fork) {
+    entt::sigh_mixin<entt::storage<int>> pool;
+    entt::registry registry;
+    counter on_construct{};
+
+    pool.bind(entt::forward_as_any(registry));
+    pool.on_construct().connect<&listener<entt::registry>>(on_construct);
+    pool.emplace(entt::entity{3}, 3);
+
+    const auto fork = pool.fork();
+
+    ASSERT_NE(fork, nullptr);
+    ASSERT_EQ(fork->type(), entt::type_id<int>());
+    ASSERT_TRUE(fork->contains(entt::entity{3}));
+
+    fork->bind(entt::forward_as_any(registry));
+    fork->push(entt::entity{42});
+
+    // listeners aren't part of a fork
+    ASSERT_EQ(on_construct.value, 1);
+    ASSERT_FALSE(pool.contains(entt::entity{42}));
+}
+
 TEST(SighMixin, Swap) {
     entt::sigh_mixin<entt::storage<int>> pool;
     entt::sigh_mixin<entt::storage<int>> other;
@@ -494,6 +494,53 @@ TEST(BasicSnapshotLoader, Orphans) {
     ASSERT_FALSE(registry.valid(entity[1u]));
 }
 
+TEST(BasicSnapshotLoader, Step) {
+    using traits_type = entt::entt_traits<entt::entity>;
+
+    entt::registry registry;
+    entt::basic_snapshot_loader loader{registry};
+
+    std::vector<entt::any> data{};
+    auto archive = [&data, pos = 0u](auto &elem) mutable { elem = entt::any_cast<std::remove_reference_t<decltype(elem)>>(data[pos++]); };
+    const entt::entity entity[3u]{traits_type::construct(0u, 0u), traits_type::construct(1u, 0u), traits_type::construct(2u, 1u)};
+    const int values[2u]{1, 3};
+
+    data.emplace_back(static_cast<typename traits_type::entity_type>(3u));
+    data.emplace_back(static_cast<typename traits_type::entity_type>(2u));
+
+    data.emplace_back(entity[0u]);
+    data.emplace_back(entity[1u]);
+    data.emplace_back(entity[2u]);
+
+    data.emplace_back(static_cast<typename traits_type::entity_type>(2u));
+    data.emplace_back(entity[0u]);
+    data.emplace_back(values[0u]);
+    data.emplace_back(entity[1u]);
+    data.emplace_back(values[1u]);
+
+    data.emplace_back(static_cast<typename traits_type::entity_type>(1u));
+    data.emplace_back(entity[1u]);
+
+    ASSERT_FALSE((loader.step<entt::entity, int, empty>(archive, 2u)));
+
+    ASSERT_EQ(registry.storage<entt::entity>().size(), 2u);
+    ASSERT_TRUE(registry.storage<int>().empty());
+
+    ASSERT_FALSE((loader.step<entt::entity, int, empty>(archive, 2u)));
+
+    // the entity storage is complete, free list included
+    ASSERT_TRUE(registry.valid(entity[0u]));
+    ASSERT_TRUE(registry.valid(entity[1u]));
+    ASSERT_FALSE(registry.valid(entity[2u]));
+    ASSERT_EQ(registry.storage<int>().size(), 1u);
+
+    ASSERT_TRUE((loader.step<entt::entity, int, empty>(archive, 2u)));
+
+    ASSERT_EQ(registry.get<int>(entity[0u]), values[0u]);
+    ASSERT_EQ(registry.get<int>(entity[1u]), values[1u]);
+    ASSERT_TRUE(registry.all_of<empty>(entity[1u]));
+}
+
 TEST(BasicContinuousLoader, Constructors) {
     ASSERT_FALSE(std::is_default_constructible_v<entt::basic_continuous_loader<entt::registry>>);
     ASSERT_FALSE(std::is_copy_constructible_v<entt::basic_continuous_loader<entt::registry>>);
@@ -932,3 +979,48 @@ TEST(BasicContinuousLoader, Orphans) {
     ASSERT_TRUE(registry.valid(loader.map(entity[0u])));
     ASSERT_FALSE(registry.valid(loader.map(entity[1u])));
 }
+
+TEST(BasicContinuousLoader, Step) {
+    using traits_type = entt::entt_traits<entt::entity>;
+
+    entt::registry registry;
+    entt::basic_continuous_loader loader{registry};
+
+    std::vector<entt::any> data{};
+    auto archive = [&data, pos = 0u](auto &elem) mutable { elem = entt::any_cast<std::remove_reference_t<decltype(elem)>>(data[pos++]); };
+    const entt::entity entity[2u]{traits_type::construct(0u, 0u), traits_type::construct(2u, 0u)};
+    const int values[2u]{1, 3};
+
+    for(auto round = 0; round < 2; ++round) {
+        data.emplace_back(static_cast<typename traits_type::entity_type>(2u));
+        data.emplace_back(static_cast<typename traits_type::entity_type>(2u));
+
+        data.emplace_back(entity[0u]);
+        data.emplace_back(entity[1u]);
+
+        data.emplace_back(static_cast<typename traits_type::entity_type>(2u));
+        data.emplace_back(entity[0u]);
+        data.emplace_back(values[0u] + round);
+        data.emplace_back(entity[1u]);
+        data.emplace_back(values[1u] + round);
+    }
+
+    ASSERT_FALSE((loader.step<entt::entity, int>(archive, 3u)));
+
+    // the mapping is kept between calls
+    ASSERT_TRUE(loader.contains(entity[0u]));
+    ASSERT_TRUE(loader.contains(entity[1u]));
+    ASSERT_EQ(registry.storage<int>().size(), 1u);
+
+    ASSERT_TRUE((loader.step<entt::entity, int>(archive, 3u)));
+
+    ASSERT_EQ(registry.get<int>(loader.map(entity[0u])), values[0u]);
+    ASSERT_EQ(registry.get<int>(loader.map(entity[1u])), values[1u]);
+
+    // the loader is ready for the next snapshot once done
+    ASSERT_TRUE((loader.step<entt::entity, int>(archive, 8u)));
+
+    ASSERT_EQ(registry.storage<entt::entity>().free_list(), 2u);
+    ASSERT_EQ(registry.get<int>(loader.map(entity[0u])), values[0u] + 1);
+    ASSERT_EQ(registry.get<int>(loader.map(entity[1u])), values[1u] + 1);
+}
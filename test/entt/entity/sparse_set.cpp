@@ -5,6 +5,7 @@
 #include <iterator>
 #include <memory>
 #include <utility>
+#include <vector>
 #include <gtest/gtest.h>
 #include <entt/entity/entity.hpp>
 #include <entt/entity/sparse_set.hpp>
@@ -142,6 +143,46 @@ TYPED_TEST(SparseSet, Move) {
     }
 }
 
+TYPED_TEST(SparseSet, Copy) {
+    using sparse_set_type = entt::basic_sparse_set<typename TestFixture::type>;
+    using allocator_type = typename sparse_set_type::allocator_type;
+    using entity_type = typename sparse_set_type::entity_type;
+    using traits_type = entt::entt_traits<entity_type>;
+
+    for(const auto policy: this->deletion_policy) {
+        sparse_set_type set{entt::type_id<int>(), policy};
+        const entity_type entity[2u]{entity_type{42}, traits_type::construct(traits_type::page_size + 3u, 1u)};
+
+        set.push(std::begin(entity), std::end(entity));
+        set.erase(entity[0u]);
+
+        sparse_set_type other{set, allocator_type{}};
+
+        ASSERT_EQ(other.policy(), policy);
+        ASSERT_EQ(other.type(), entt::type_id<int>());
+        ASSERT_EQ(other.size(), set.size());
+        ASSERT_EQ(other.free_list(), set.free_list());
+        ASSERT_FALSE(other.contains(entity[0u]));
+        ASSERT_TRUE(other.contains(entity[1u]));
+        ASSERT_EQ(other.index(entity[1u]), set.index(entity[1u]));
+
+        set.erase(entity[1u]);
+
+        ASSERT_TRUE(other.contains(entity[1u]));
+
+        const auto fork = other.fork();
+
+        ASSERT_NE(fork, nullptr);
+        ASSERT_EQ(fork->policy(), policy);
+        ASSERT_TRUE(fork->contains(entity[1u]));
+
+        set.restore(*fork);
+
+        ASSERT_TRUE(set.contains(entity[1u]));
+        ASSERT_EQ(set.free_list(), fork->free_list());
+    }
+}
+
 TYPED_TEST(SparseSet, Swap) {
     using sparse_set_type = entt::basic_sparse_set<typename TestFixture::type>;
     using entity_type = typename sparse_set_type::entity_type;
@@ -1153,6 +1194,32 @@ TYPED_TEST(SparseSet, PushOutOfBounds) {
     }
 }
 
+TEST(SparseSet, PushRangeThroughTryEmplace) {
+    struct custom_pool final: entt::sparse_set {
+        std::vector<int> elements{};
+
+    protected:
+        basic_iterator try_emplace(const entt::entity entt, const bool force_back, const void *value) override {
+            elements.push_back(value ? *static_cast<const int *>(value) : 0);
+            return entt::sparse_set::try_emplace(entt, force_back, value);
+        }
+    };
+
+    entt::sparse_set source{};
+    custom_pool pool{};
+    const entt::entity entity[3u]{entt::entity{3}, entt::entity{1}, entt::entity{42}};
+    const int value = 7;
+
+    source.push(std::begin(entity), std::end(entity));
+    // the default bulk path goes through try_emplace
+    pool.push(source.begin(), source.end(), &value);
+
+    ASSERT_EQ(pool.size(), 3u);
+    ASSERT_EQ(pool.elements.size(), 3u);
+    ASSERT_TRUE(std::all_of(pool.elements.cbegin(), pool.elements.cend(), [value](auto elem) { return elem == value; }));
+    ASSERT_TRUE(std::all_of(std::begin(entity), std::end(entity), [&pool](auto entt) { return pool.contains(entt); }));
+}
+
 ENTT_DEBUG_TYPED_TEST(SparseSetDeathTest, Push) {
     using sparse_set_type = entt::basic_sparse_set<typename TestFixture::type>;
     using entity_type = typename sparse_set_type::entity_type;
@@ -1673,6 +1740,118 @@ TYPED_TEST(SparseSet, Clear) {
     }
 }
 
+TYPED_TEST(SparseSet, ClearDense) {
+    using sparse_set_type = entt::basic_sparse_set<typename TestFixture::type>;
+    using entity_type = typename sparse_set_type::entity_type;
+    using traits_type = typename sparse_set_type::traits_type;
+
+    for(const auto policy: this->deletion_policy) {
+        sparse_set_type set{policy};
+
+        for(std::size_t next{}; next < traits_type::page_size; ++next) {
+            set.push(entity_type(next));
+        }
+
+        // sparse pages are reset in bulk
+        set.clear();
+
+        ASSERT_EQ(set.size(), 0u);
+
+        for(std::size_t next{}; next < traits_type::page_size; ++next) {
+            ASSERT_FALSE(set.contains(entity_type(next)));
+        }
+
+        set.push(entity_type{3});
+
+        ASSERT_TRUE(set.contains(entity_type{3}));
+        ASSERT_EQ(set.index(entity_type{3}), 0u);
+    }
+}
+
+TYPED_TEST(SparseSet, EraseSwapsWithLast) {
+    using sparse_set_type = entt::basic_sparse_set<typename TestFixture::type>;
+    using entity_type = typename sparse_set_type::entity_type;
+
+    sparse_set_type set{entt::deletion_policy::swap_and_pop};
+
+    for(std::size_t next{}; next < 16u; ++next) {
+        set.push(entity_type(next));
+    }
+
+    // small ranges only touch the removed elements and the last ones
+    set.erase(entity_type{0});
+    set.erase(entity_type{1});
+
+    ASSERT_EQ(set.size(), 14u);
+    ASSERT_EQ(set.data()[0u], entity_type{15});
+    ASSERT_EQ(set.data()[1u], entity_type{14});
+
+    for(std::size_t next{2u}; next < set.size(); ++next) {
+        ASSERT_EQ(set.data()[next], entity_type(next));
+        ASSERT_EQ(set.index(entity_type(next)), next);
+    }
+
+    const entity_type entity[4u]{entity_type{12}, entity_type{10}, entity_type{13}, entity_type{11}};
+    set.erase(std::begin(entity), std::end(entity));
+
+    // elements before the lowest removed position never move
+    ASSERT_EQ(set.size(), 10u);
+    ASSERT_EQ(set.data()[0u], entity_type{15});
+    ASSERT_EQ(set.data()[1u], entity_type{14});
+
+    for(std::size_t next{2u}; next < set.size(); ++next) {
+        ASSERT_EQ(set.data()[next], entity_type(next));
+    }
+}
+
+TYPED_TEST(SparseSet, SkipTombstones) {
+    using sparse_set_type = entt::basic_sparse_set<typename TestFixture::type>;
+    using entity_type = typename sparse_set_type::entity_type;
+    using traits_type = typename sparse_set_type::traits_type;
+
+    for(const auto policy: this->deletion_policy) {
+        sparse_set_type set{policy};
+
+        ASSERT_EQ(set.skip_tombstones(set.begin()), set.end());
+
+        for(std::size_t next{}; next < 256u; ++next) {
+            set.push(entity_type(next));
+        }
+
+        for(std::size_t next{1u}; next < 256u; ++next) {
+            if(next != 7u && next != 130u) {
+                set.erase(entity_type(next));
+            }
+        }
+
+        auto it = set.skip_tombstones(set.begin());
+
+        if(policy == entt::deletion_policy::in_place) {
+            ASSERT_EQ(*it, entity_type{130});
+            ASSERT_EQ(*(it = set.skip_tombstones(++it)), entity_type{7});
+            ASSERT_EQ(*(it = set.skip_tombstones(++it)), entity_type{0});
+            ASSERT_EQ(set.skip_tombstones(++it), set.end());
+
+            set.erase(entity_type{0});
+            set.push(entity_type{1});
+
+            ASSERT_EQ(*set.skip_tombstones(set.find(entity_type{7}) + 1), entity_type{1});
+        } else {
+            ASSERT_EQ(it, set.begin());
+            ASSERT_EQ(set.skip_tombstones(set.end()), set.end());
+        }
+
+        if(policy == entt::deletion_policy::swap_and_pop) {
+            const auto entity = traits_type::construct(traits_type::to_entity(entity_type{7}), traits_type::to_version(entt::tombstone));
+            set.erase(entity_type{7});
+            set.push(entity);
+
+            ASSERT_EQ(*set.begin(), entity);
+            ASSERT_EQ(set.skip_tombstones(set.begin()), set.begin() + 1);
+        }
+    }
+}
+
 TYPED_TEST(SparseSet, SortOrdered) {
     using sparse_set_type = entt::basic_sparse_set<typename TestFixture::type>;
     using entity_type = typename sparse_set_type::entity_type;
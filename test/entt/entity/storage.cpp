@@ -6,6 +6,7 @@
 #include <type_traits>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 #include <gtest/gtest.h>
 #include <entt/entity/component.hpp>
 #include <entt/entity/storage.hpp>
@@ -166,6 +167,74 @@ TYPED_TEST(Storage, Move) {
     ASSERT_EQ(other.get(entt::entity{3}), value_type{3});
 }
 
+TYPED_TEST(Storage, Copy) {
+    using value_type = typename TestFixture::type;
+    using traits_type = entt::component_traits<value_type>;
+    entt::storage<value_type> pool;
+    const entt::entity entity[3u]{entt::entity{3}, entt::entity{42}, entt::entity{1}};
+
+    pool.emplace(entity[0u], 3);
+    pool.emplace(entity[1u], 42);
+    pool.emplace(entity[2u], 1);
+    pool.erase(entity[1u]);
+
+    entt::storage<value_type> other{pool, pool.get_allocator()};
+
+    ASSERT_EQ(other.type(), entt::type_id<value_type>());
+    ASSERT_EQ(other.size(), pool.size());
+    ASSERT_FALSE(other.contains(entity[1u]));
+    ASSERT_EQ(other.get(entity[0u]), value_type{3});
+    ASSERT_EQ(other.get(entity[2u]), value_type{1});
+
+    if constexpr(traits_type::in_place_delete) {
+        ASSERT_EQ(other.at(1u), static_cast<entt::entity>(entt::tombstone));
+    }
+
+    pool.get(entity[0u]) = value_type{0};
+
+    ASSERT_EQ(other.get(entity[0u]), value_type{3});
+
+    const std::shared_ptr<entt::sparse_set> fork = other.fork();
+
+    ASSERT_NE(fork, nullptr);
+    ASSERT_EQ(fork->type(), entt::type_id<value_type>());
+    ASSERT_EQ(*static_cast<const value_type *>(fork->value(entity[2u])), value_type{1});
+
+    static_cast<entt::sparse_set &>(pool).restore(*fork);
+
+    ASSERT_EQ(pool.size(), other.size());
+    ASSERT_EQ(pool.get(entity[0u]), value_type{3});
+    ASSERT_EQ(pool.get(entity[2u]), value_type{1});
+}
+
+TEST(Storage, CopyNonTrivialType) {
+    entt::storage<std::unique_ptr<int>> pool;
+    entt::storage<std::shared_ptr<int>> other;
+
+    pool.emplace(entt::entity{3}, std::make_unique<int>(3));
+    other.emplace(entt::entity{3}, std::make_shared<int>(3));
+
+    ASSERT_EQ(pool.fork(), nullptr);
+
+    const auto fork = other.fork();
+
+    ASSERT_NE(fork, nullptr);
+    ASSERT_EQ(other.get(entt::entity{3}).use_count(), 2);
+
+    fork->clear();
+
+    ASSERT_EQ(other.get(entt::entity{3}).use_count(), 1);
+}
+
+ENTT_DEBUG_TEST(StorageDeathTest, RestoreNonCopyableType) {
+    entt::storage<std::unique_ptr<int>> pool;
+    entt::storage<std::unique_ptr<int>> other;
+
+    other.emplace(entt::entity{3}, std::make_unique<int>(3));
+
+    ASSERT_DEATH(static_cast<entt::sparse_set &>(pool).restore(other), "");
+}
+
 TYPED_TEST(Storage, Swap) {
     using value_type = typename TestFixture::type;
     using traits_type = entt::component_traits<value_type>;
@@ -697,6 +766,35 @@ TYPED_TEST(Storage, TryEmplace) {
     ASSERT_EQ(pool.get(entity[1u]), value_type{});
 }
 
+TYPED_TEST(Storage, TryInsert) {
+    using value_type = typename TestFixture::type;
+    entt::storage<value_type> pool;
+    entt::sparse_set &base = pool;
+    entt::sparse_set other;
+
+    const entt::entity entity[3u]{entt::entity{3}, entt::entity{42}, entt::entity{1}};
+    value_type instance{42};
+
+    other.push(std::begin(entity), std::end(entity));
+
+    ASSERT_EQ(base.push(other.end(), other.end(), &instance), base.end());
+    ASSERT_TRUE(pool.empty());
+
+    ASSERT_NE(base.push(other.begin(), other.end(), &instance), base.end());
+
+    ASSERT_EQ(pool.size(), 3u);
+    ASSERT_EQ(pool.at(0u), entity[2u]);
+    ASSERT_EQ(pool.at(2u), entity[0u]);
+    ASSERT_EQ(pool.get(entity[0u]), value_type{42});
+    ASSERT_EQ(pool.get(entity[1u]), value_type{42});
+    ASSERT_EQ(pool.get(entity[2u]), value_type{42});
+
+    pool.clear();
+
+    ASSERT_NE(base.push(other.begin(), other.end(), nullptr), base.end());
+    ASSERT_EQ(pool.get(entity[1u]), value_type{});
+}
+
 TEST(Storage, TryEmplaceNonDefaultConstructible) {
     using value_type = std::pair<int &, int &>;
     static_assert(!std::is_default_constructible_v<value_type>, "Default constructible types not allowed");
@@ -923,6 +1021,41 @@ TYPED_TEST(Storage, CrossErase) {
     ASSERT_EQ(pool.raw()[0u][0u], value_type{3});
 }
 
+TYPED_TEST(Storage, CrossEraseRange) {
+    using value_type = typename TestFixture::type;
+    using traits_type = entt::component_traits<value_type>;
+    entt::storage<value_type> pool;
+    entt::sparse_set set;
+
+    for(int next{}; next < 64; ++next) {
+        pool.emplace(entt::entity(next), next);
+
+        if(next % 3 != 0) {
+            set.push(entt::entity(next));
+        }
+    }
+
+    pool.erase(set.begin(), set.end());
+
+    if constexpr(traits_type::in_place_delete) {
+        ASSERT_EQ(pool.size(), 64u);
+    } else {
+        ASSERT_EQ(pool.size(), 22u);
+    }
+
+    for(int next{}; next < 64; ++next) {
+        const auto entity = entt::entity(next);
+
+        if(next % 3 == 0) {
+            ASSERT_TRUE(pool.contains(entity));
+            ASSERT_EQ(pool.at(pool.index(entity)), entity);
+            ASSERT_EQ(pool.get(entity), value_type{next});
+        } else {
+            ASSERT_FALSE(pool.contains(entity));
+        }
+    }
+}
+
 TYPED_TEST(Storage, Remove) {
     using value_type = typename TestFixture::type;
     using traits_type = entt::component_traits<value_type>;
@@ -1054,6 +1187,38 @@ TYPED_TEST(Storage, Compact) {
     ASSERT_TRUE(pool.empty());
 }
 
+TEST(Storage, CompactStep) {
+    entt::storage<pointer_stable> pool;
+    std::vector<entt::entity> moved{};
+
+    for(int next{}; next < 8; ++next) {
+        pool.emplace(entt::entity(next), next);
+    }
+
+    for(int next{}; next < 4; ++next) {
+        pool.erase(entt::entity(next));
+    }
+
+    ASSERT_EQ(pool.size(), 8u);
+    ASSERT_FALSE(pool.compact_step(2u, [&moved](const entt::entity entity) { moved.push_back(entity); }));
+
+    ASSERT_EQ(moved.size(), 2u);
+    ASSERT_EQ(pool.size(), 6u);
+
+    for(const auto entity: moved) {
+        ASSERT_LT(pool.index(entity), 4u);
+        ASSERT_EQ(pool.get(entity).value, static_cast<int>(entt::to_integral(entity)));
+    }
+
+    ASSERT_TRUE(pool.compact_step(2u));
+    ASSERT_EQ(pool.size(), 4u);
+    ASSERT_TRUE(pool.compact_step(0u));
+
+    for(int next{4}; next < 8; ++next) {
+        ASSERT_EQ(pool.get(entt::entity(next)).value, next);
+    }
+}
+
 TYPED_TEST(Storage, SwapElements) {
     using value_type = typename TestFixture::type;
     using traits_type = entt::component_traits<value_type>;
@@ -1200,6 +1365,38 @@ TYPED_TEST(Storage, IterableAlgorithmCompatibility) {
     ASSERT_EQ(std::get<0>(*it), entt::entity{3});
 }
 
+TYPED_TEST(Storage, IterableSkipsTombstones) {
+    using value_type = typename TestFixture::type;
+    using traits_type = entt::component_traits<value_type>;
+    entt::storage<value_type> pool;
+
+    pool.emplace(entt::entity{1}, 1);
+    pool.emplace(entt::entity{2}, 2);
+    pool.emplace(entt::entity{3}, 3);
+    pool.emplace(entt::entity{4}, 4);
+
+    pool.erase(entt::entity{4});
+    pool.erase(entt::entity{2});
+    pool.erase(entt::entity{3});
+
+    ASSERT_EQ(pool.size(), traits_type::in_place_delete ? 4u : 1u);
+
+    std::size_t count{};
+
+    for(auto [entity, element]: pool.each()) {
+        ASSERT_EQ(entity, entt::entity{1});
+        ASSERT_EQ(element, value_type{1});
+        ++count;
+    }
+
+    ASSERT_EQ(count, 1u);
+
+    pool.erase(entt::entity{1});
+
+    ASSERT_EQ(pool.each().begin(), pool.each().end());
+    ASSERT_EQ(std::as_const(pool).each().begin(), std::as_const(pool).each().end());
+}
+
 TYPED_TEST(Storage, ReverseIterable) {
     using value_type = typename TestFixture::type;
     using iterator = typename entt::storage<value_type>::reverse_iterable::iterator;
@@ -1837,6 +2034,15 @@ TEST(Storage, ThrowingComponent) {
     ASSERT_TRUE(pool.contains(entt::entity{1}));
     ASSERT_EQ(pool.get(entt::entity{1}), 1);
 
+    entt::sparse_set set;
+    set.push(std::begin(entity), std::end(entity));
+    pool.clear();
+
+    // basic exception safety
+    ASSERT_THROW(static_cast<entt::sparse_set &>(pool).push(set.begin(), set.end(), &components[0u]), typename test::throwing_type::exception_type);
+    ASSERT_EQ(pool.size(), 0u);
+    ASSERT_FALSE(pool.contains(entt::entity{1}));
+
     pool.clear();
     pool.emplace(entt::entity{1}, 1);
     pool.emplace(entt::entity{42}, 42);
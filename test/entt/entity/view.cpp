@@ -2,6 +2,7 @@
 #include <iterator>
 #include <tuple>
 #include <utility>
+#include <vector>
 #include <gtest/gtest.h>
 #include <entt/entity/registry.hpp>
 #include <entt/entity/view.hpp>
@@ -485,6 +486,29 @@ TEST(SingleComponentView, StableType) {
     ASSERT_EQ(view.size_hint(), 1u);
 }
 
+TEST(SingleComponentView, FragmentedStableType) {
+    entt::registry registry;
+    auto view = registry.view<stable_type>();
+    std::vector<entt::entity> entity(512u);
+
+    registry.create(entity.begin(), entity.end());
+    registry.insert<stable_type>(entity.begin(), entity.end());
+
+    for(std::size_t pos{}; pos < entity.size(); ++pos) {
+        if(pos % 100u != 0u) {
+            registry.erase<stable_type>(entity[pos]);
+        }
+    }
+
+    std::vector<entt::entity> visited{view.begin(), view.end()};
+
+    ASSERT_EQ(visited.size(), 6u);
+
+    for(std::size_t pos{}; pos < visited.size(); ++pos) {
+        ASSERT_EQ(visited[pos], entity[(visited.size() - pos - 1u) * 100u]);
+    }
+}
+
 TEST(SingleComponentView, Storage) {
     entt::registry registry;
     const auto entity = registry.create();